@@ -36,6 +36,24 @@ static_assert((__cplusplus >= 201703L), "Supported only with C++17 and newer!");
 #include <concepts>
 #endif
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Threads are used only for the host builds
+#ifdef ISO_META_TYPE_HOST
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 // General namespace for the module
 namespace iso::meta_type {
 
@@ -65,6 +83,20 @@ template <const auto &param> struct ConstReference final {
   };
 };
 
+/**
+ * @brief Template to convert reference to the writable object to constexpr (the address is constant, the object is not)
+ *
+ * @tparam param: Reference to the writable object with static storage that will be casted to constexpr
+ */
+template <auto &param> struct MutableReference final {
+  static_assert(!std::is_const_v<std::remove_reference_t<decltype(param)>>, "Referenced object should be writable!");
+  using type = decltype(param);
+  static constexpr auto &value = param;
+  struct MutableReferenceT {
+    using type = void;
+  };
+};
+
 // Cast to the real const value
 template <const auto value> inline constexpr auto const_v = ConstValue<value>{};
 // Cast to the real const type
@@ -75,6 +107,11 @@ template <const auto &value> inline constexpr auto const_ref_v = ConstReference<
 // Cast to the real const reference
 template <const auto &value> using const_ref_t = ConstReference<value>;
 
+// Cast to the constant reference to the writable object
+template <auto &value> inline constexpr auto mut_ref_v = MutableReference<value>{};
+// Cast to the constant reference to the writable object
+template <auto &value> using mut_ref_t = MutableReference<value>;
+
 // Concept for C++20 to check type for ConstValue
 #ifdef __cpp_concepts
 template <typename T>
@@ -98,6 +135,14 @@ concept const_reference = requires(T) {
 template <typename T, typename Type>
 concept const_reference_of_type = const_reference<T> && std::same_as<Type, typename T::type>;
 
+// Concept for C++20 to check type for MutableReference
+template <typename T>
+concept mutable_reference = requires(T) {
+  typename T::MutableReferenceT;
+  T::value;
+  typename T::type;
+};
+
 // Array operation
 template <typename T>
 concept array = std::is_array_v<T>;
@@ -117,6 +162,28 @@ template <typename T> struct is_const<T, typename T::ConstValueT::type> {
 
 template <typename T> inline constexpr auto is_const_v = is_const<T>::value;
 
+// Type traits for SFINAE to check type for ConstReference
+template <typename T, typename U = void> struct is_const_ref {
+  static constexpr auto value = false;
+};
+
+template <typename T> struct is_const_ref<T, typename T::ConstReferenceT::type> {
+  static constexpr auto value = true;
+};
+
+template <typename T> inline constexpr auto is_const_ref_v = is_const_ref<T>::value;
+
+// Type traits for SFINAE to check type for MutableReference
+template <typename T, typename U = void> struct is_writable_ref {
+  static constexpr auto value = false;
+};
+
+template <typename T> struct is_writable_ref<T, typename T::MutableReferenceT::type> {
+  static constexpr auto value = true;
+};
+
+template <typename T> inline constexpr auto is_writable_ref_v = is_writable_ref<T>::value;
+
 /**
  * @brief Class that implements compile time template variadic pack analysis
  *        Supposed that all types inside variadic pack are unique
@@ -127,6 +194,9 @@ template <typename T> inline constexpr auto is_const_v = is_const<T>::value;
  *        - Ensure that is all types are unique'<typename ...Args>'
  *        - Ensure that is all types are unique'<const auto ...args>'
  *        - Extract the value according to a type from the given pack (if no type found - return default type value)
+ *        - Extract the runtime argument according to a type with perfect forwarding (forward_type)
+ *        - Collect all values of a type from the pack (get_all, count_v, for_each_of, fold_of)
+ *        - Skip the validation of the pack verified ahead of time by the same rules (verified, is_verified_v, is_stale_v, validate)
  *        Please, check specific methods, unit tests and Readme for the usage example
  */
 class var_pack {
@@ -140,10 +210,11 @@ class var_pack {
 
   template <typename T, typename U> static constexpr bool is_same_v = is_same<T, U>::value;
 
+  // Traits over the pack are std::conjunction: evaluation stops at the first failed element and the rest of the pack is only named,
+  // never instantiated. Comparisons for one element are a fold over std::is_same_v (no class instantiation per pair)
   template <typename... Types> class is_types_unique {
-    template <typename First, typename... Rest> struct duplicate_type {
-      static constexpr bool value = (!is_same_v<First, Rest> && ...) && duplicate_type<Rest...>::value;
-    };
+    template <typename First, typename... Rest>
+    struct duplicate_type : std::conjunction<std::bool_constant<!(std::is_same_v<First, Rest> || ...)>, duplicate_type<Rest...>> {};
 
     template <typename First> struct duplicate_type<First> {
       static constexpr bool value = true;
@@ -160,103 +231,51 @@ class var_pack {
   };
 
   struct duplicate {
-    template <typename T> inline static constexpr bool is_same_v(const T, const T) { return true; }
-    template <typename T, typename U> inline static constexpr bool is_same_v(const T, const U) { return false; }
-
     inline static constexpr bool duplicate_types_val() { return true; }
-    template <typename First> inline static constexpr bool duplicate_types_val(const First) { return true; }
-    template <typename First, typename... Rest> inline static constexpr bool duplicate_types_val(const First first, const Rest... rest) {
-      return (!is_same_v(first, rest) && ...) && duplicate_types_val(rest...);
+    template <typename First, typename... Rest> inline static constexpr bool duplicate_types_val(const First, const Rest...) {
+      return is_types_unique<First, Rest...>::value;
     }
   };
 
-  template <typename TypeFirst, typename... TypesRest> struct contains_list {
-    inline static constexpr bool is_parameter_inside(const TypeFirst) { return true; }
-    template <typename Value> inline static constexpr bool is_parameter_inside(const Value value) {
-      return contains_list<TypesRest...>::is_parameter_inside(value);
-    }
+  template <typename T> struct set_element {};
+  // Element through the position in the list: a repeated type is an ambiguous indirect base, not a duplicated direct one
+  template <typename T, const std::size_t index> struct set_slot : set_element<T> {};
+  template <typename Indices, typename... Types> struct set_slots;
+  template <std::size_t... indices, typename... Types> struct set_slots<std::index_sequence<indices...>, Types...> : set_slot<Types, indices>... {};
 
-    inline static constexpr bool contains() { return true; }
-    template <typename First, typename... Rest> inline static constexpr bool contains(const First first, const Rest... rest) {
-      return is_parameter_inside(first) ? contains(rest...) : false;
-    }
-  };
+  // Pack verified by any schema (base of every 'verified' of the pack)
+  template <const auto... args> struct verified_pack {};
 
-  template <typename TypeFirst> struct contains_list<TypeFirst> {
-    inline static constexpr bool is_parameter_inside(const TypeFirst) { return true; }
-    template <typename Value> inline static constexpr bool is_parameter_inside(const Value) { return false; }
+public:
+  /**
+   * @brief Set of types built once: the set inherits one base per type, so membership is the derived-to-base check
+   *        instead of the comparison with every type of the list
+   *
+   * @note   Usage guideline: var_pack::type_set<'your predefined types'>::contains_v<'Args...'>
+   *         Types of the set can repeat (std::is_base_of_v ignores the ambiguity of the repeated base)
+   *
+   * @tparam Types Types of the set
+   */
+  template <typename... Types> struct type_set : set_slots<std::index_sequence_for<Types...>, Types...> {
+    template <typename T> struct is_inside : std::bool_constant<std::is_base_of_v<set_element<T>, type_set>> {};
 
-    inline static constexpr bool contains() { return true; }
-    template <typename First, typename... Rest> inline static constexpr bool contains(const First first, const Rest... rest) {
-      return is_parameter_inside(first) ? contains(rest...) : false;
-    }
+    template <typename... Params> static constexpr bool contains_v = std::conjunction<is_inside<Params>...>::value;
   };
 
-public:
   /**
    * @brief Search that all types of '<typename ...Args>' are belonging to predefined type list
    *
    * @note   Usage guideline: var_pack::is_type_list<'your predefined types'>::contains_v<'Args...'>
+   *         The list is compiled once into the type_set and shared by all queries (also is_type_val_list ones)
    *
    * @tparam TypeFirst First type in the list
    * @tparam TypeRest  Rest types from the list
    */
   template <typename TypeFirst, typename... TypeRest> class is_type_list {
-  protected:
-    template <typename T> struct is_parameter_inside : public is_type_list<TypeRest...> {
-      static constexpr bool value = is_same_v<T, TypeFirst> ? true : is_type_list<TypeRest...>::template is_parameter_inside<T>::value;
-    };
-
-  private:
-    template <typename ParamFirst, typename... ParamRest> struct contains {
-      static constexpr bool value = is_parameter_inside<ParamFirst>::value ? contains<ParamRest...>::value : false;
-    };
-
-    template <typename ParamFirst> struct contains<ParamFirst> {
-      static constexpr bool value = is_parameter_inside<ParamFirst>::value ? true : false;
-    };
-
   public:
-    template <typename... Params>
-    static constexpr bool contains_v = []() {
-      if constexpr (sizeof...(Params)) {
-        return contains<Params...>::value;
-      } else {
-        return true;
-      }
-    }();
-  };
-
-  /**
-   * @brief Search that all types of '<typename ...Args>' are belonging to predefined type list
-   *        Overloading for one type to stop infinite recursion
-   *
-   * @tparam TypeFirst The last list type
-   */
-  template <typename TypeFirst> class is_type_list<TypeFirst> {
-  protected:
-    template <typename T> struct is_parameter_inside {
-      static constexpr bool value = is_same_v<T, TypeFirst> ? true : false;
-    };
-
-  private:
-    template <typename ParamFirst, typename... ParamRest> struct contains {
-      static constexpr bool value = is_parameter_inside<ParamFirst>::value ? contains<ParamRest...>::value : false;
-    };
-
-    template <typename ParamFirst> struct contains<ParamFirst> {
-      static constexpr bool value = is_parameter_inside<ParamFirst>::value ? true : false;
-    };
+    using set = type_set<TypeFirst, TypeRest...>;
 
-  public:
-    template <typename... Params>
-    static constexpr bool contains_v = []() {
-      if constexpr (sizeof...(Params)) {
-        return contains<Params...>::value;
-      } else {
-        return true;
-      }
-    }();
+    template <typename... Params> static constexpr bool contains_v = set::template contains_v<Params...>;
   };
 
   template <typename... Types> static constexpr bool is_types_unique_v = is_types_unique<Types...>::value;
@@ -277,15 +296,15 @@ public:
    * @brief Search that all types of '<const auto... args>' are belonging to predefined type list
    *
    * @note   Usage guideline: var_pack::is_type_val_list<'your predefined types'>::contains_v('args...')
+   *         Lookups go through the same type_set as is_type_list
    *
    * @tparam TypeFirst First type in the list
    * @tparam TypeRest  Rest types from the list
    */
   template <typename TypeFirst, typename... TypesRest> struct is_type_val_list {
-    inline static constexpr bool contains_v() { return true; }
-    template <typename First, typename... Rest> inline static constexpr bool contains_v(const First first, const Rest... rest) {
-      return contains_list<TypeFirst, TypesRest...>::contains(first, rest...);
-    }
+    using set = type_set<TypeFirst, TypesRest...>;
+
+    template <typename... Params> inline static constexpr bool contains_v(const Params...) { return set::template contains_v<Params...>; }
   };
 
   /**
@@ -303,6 +322,125 @@ public:
     template <typename... Rest> inline static constexpr Type get(const Type first, const Rest...) { return first; }
     template <typename First, typename... Rest> inline static constexpr Type get(const First, const Rest... rest) { return get(rest...); }
   };
+
+  // Number of the type occurrences in the pack '<typename ...Args>' (for '<const auto ...args>' use 'decltype(args)...')
+  template <typename Type, typename... Args> static constexpr std::size_t count_v = (std::size_t{is_same_v<Type, Args>} + ... + 0U);
+
+  /**
+   * @brief Collect all values of the type from the given pack in the order
+   *
+   * @note   Usage guideline: var_pack::get_all<'type of value'>('args...') returns std::array of var_pack::count_v<'type', 'Args...'> values
+   *         Values of the other types are skipped, the cost is linear in the pack size
+   *
+   * @tparam Type Type of values
+   */
+  template <typename Type, typename... Args>
+  inline static constexpr std::array<Type, count_v<Type, Args...>> get_all([[maybe_unused]] const Args... args) {
+    std::array<Type, count_v<Type, Args...>> result{};
+    [[maybe_unused]] std::size_t index = 0;
+    (
+        [&](const auto arg) {
+          if constexpr (is_same_v<Type, std::remove_cv_t<decltype(arg)>>) {
+            result[index++] = arg;
+          }
+        }(args),
+        ...);
+    return result;
+  }
+
+  // Call the function for every value of the type from the pack: function(value)
+  template <typename Type, typename Function, typename... Args> inline static constexpr void for_each_of(Function &&function, const Args... args) {
+    for (const Type value : get_all<Type>(args...)) {
+      function(value);
+    }
+  }
+
+  // Fold all values of the type from the pack in the order: function(...function(function(initial, v0), v1)..., vN)
+  template <typename Type, typename T, typename Function, typename... Args>
+  inline static constexpr T fold_of(T initial, Function &&function, const Args... args) {
+    for (const Type value : get_all<Type>(args...)) {
+      initial = function(initial, value);
+    }
+    return initial;
+  }
+
+  // Pack '<const auto... args>' verified ahead of time by the rules of the schema: the marker type inherits one base per verified pack
+  template <typename Schema, const auto... args> struct verified : verified_pack<args...> {};
+
+  // Marker has the base for exactly this pack (the same types and values in the same order) verified by the same schema
+  template <typename Marker, typename Schema, const auto... args>
+  static constexpr bool is_verified_v = std::is_base_of_v<verified<Schema, args...>, Marker>;
+
+  // Marker has the base for this pack, but verified by other schema (the rules are changed after the generation)
+  template <typename Marker, typename Schema, const auto... args>
+  static constexpr bool is_stale_v = std::is_base_of_v<verified_pack<args...>, Marker> && !is_verified_v<Marker, Schema, args...>;
+
+  /**
+   * @brief Validation of the pack cached ahead of time: the generator of the configuration runs the full validation once and emits
+   *        the pre-verified marker type, consuming translation units only look up the pack in the marker bases
+   *
+   * @note   Usage guideline: var_pack::validate<'marker', 'schema', 'args...'>([](auto... args) { return 'full validation'; })
+   *         Generator emits 'struct Marker : var_pack::verified<'schema', 'args of config 1'...>, var_pack::verified<'schema', 'args of config 2'...> {};'
+   *         The consistency check is the identity of the schema and the pack (template arguments are interned by the compiler, so no extra work),
+   *         the validation is not instantiated if the marker matches. Stale configuration (changed after the generation) falls back
+   *         to the full validation, stale schema (the checks are changed, so the schema tag is changed) is a compilation error
+   *
+   * @tparam Marker     Pre-verified marker type (any type without the base of the pack means "not verified")
+   * @tparam Schema     Tag of the current validation rules, e.g. const_t<'version'> or const_t<'hash of the checks'>
+   * @tparam args       Values of the pack
+   * @tparam Validation Generic callable: bool(args...)
+   */
+  template <typename Marker, typename Schema, const auto... args, typename Validation>
+  inline static constexpr bool validate([[maybe_unused]] Validation &&validation) {
+    static_assert(!is_stale_v<Marker, Schema, args...>, "Marker is generated for other validation schema, the generator should be rerun!");
+    if constexpr (is_verified_v<Marker, Schema, args...>) {
+      return true;
+    } else {
+      return validation(args...);
+    }
+  }
+
+  /**
+   * @brief Extract the argument according to a type from the given pack at runtime with perfect forwarding
+   *
+   * @note   Usage guideline: var_pack::forward_type<'type of value'>::get(std::forward<Args>(args)...) or
+   *         var_pack::forward_type<'type of value'>::get_or('default', std::forward<Args>(args)...)
+   *         The argument is returned as it was passed (lvalue or rvalue reference), so rvalues are moved and nothing is copied
+   *         (the default value of get_or is returned by value),
+   *         types don't need to be structural. Search is resolved at compile time, cv and reference qualifiers of the arguments are ignored,
+   *         so the pack is validated with is_types_unique_v/is_type_list on 'std::decay_t<Args>...'
+   *
+   * @tparam Type Type of the argument
+   */
+  template <typename Type> class forward_type {
+    template <typename First, typename... Rest> inline static constexpr decltype(auto) pick(First &&first, Rest &&...rest) {
+      if constexpr (is_same_v<Type, std::remove_cv_t<std::remove_reference_t<First>>>) {
+        return std::forward<First>(first);
+      } else {
+        return pick(std::forward<Rest>(rest)...);
+      }
+    }
+
+  public:
+    // Argument of the type is in the pack
+    template <typename... Args> static constexpr bool is_inside_v = (is_same_v<Type, std::remove_cv_t<std::remove_reference_t<Args>>> || ...);
+
+    // Reference to the first argument of the type, missed argument is a compilation error
+    template <typename... Args> inline static constexpr decltype(auto) get(Args &&...args) {
+      static_assert(is_inside_v<Args...>, "No argument of the type in the pack!");
+      return pick(std::forward<Args>(args)...);
+    }
+
+    // Reference to the first argument of the type or the default value (moved or copied, so the result never refers to a temporary)
+    template <typename Default, typename... Args> inline static constexpr decltype(auto) get_or(Default &&defaultValue, Args &&...args) {
+      static_assert(std::is_convertible_v<Default &&, Type>, "Default value should be convertible to the type!");
+      if constexpr (is_inside_v<Args...>) {
+        return pick(std::forward<Args>(args)...);
+      } else {
+        return std::decay_t<Default>(std::forward<Default>(defaultValue));
+      }
+    }
+  };
 };
 
 #ifdef __cpp_concepts
@@ -312,122 +450,3329 @@ concept types_unique = var_pack::is_types_unique_v<Types...>;
 template <const auto... Values>
 concept types_val_unique = var_pack::is_types_val_unique_v<Values...>;
 #endif
+} // namespace iso::meta_type
 
-#ifdef ISO_META_TYPE_UNITTEST
-// Unit test for the module. As it is compile time - can be performed during every compilation
-namespace unit_tests {
-// Test Types
-struct TestType1 {};
-struct TestType2 {};
-struct TestType3 {};
-enum class TestType4 : unsigned { TestValue0 = 0x5667U, TestValue1 = 0xA100U, TestValue2 = 0x7832AD01UL };
-enum class TestType5 : int { TestValue0 = -777, TestValue1 = 256901 };
-enum class TestType6 { TestValue0, TestValue1, TestValue2, TestValue3 };
-using TestType7 = bool;
-using TestType8 = unsigned long;
-using TestType9 = unsigned;
+// Vector extensions for 'shuffle', only the header of the widest enabled set
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
-template <typename... Args> inline constexpr bool unique_args(const Args...) { return var_pack::is_types_unique_v<Args...>; }
-template <typename... Args> inline constexpr bool unique_args2(const Args... args) { return var_pack::is_types_val_unique_v(args...); }
-template <typename... Args> inline constexpr bool types456inside(const Args...) {
-  return var_pack::is_type_list<TestType4, TestType5, TestType6>::contains_v<Args...>;
-}
+namespace iso::meta_type {
+/**
+ * @brief Compile-time shuffle (swizzle) of a fixed-size block of elements: out[i] = in[indexes[i]]
+ *
+ * @note  Usage guideline: shuffle<'element type', 'indexes...'>::apply('in', 'out')
+ *        The pattern is validated at compile time and the cheapest instruction that is enabled for the target is selected:
+ *        - identity pattern                          - plain copy
+ *        - 4 x 32-bit or 16 x 8-bit moving dwords    - SSE2 pshufd with immediate
+ *        - 16 x 8-bit                                - SSSE3 pshufb
+ *        - 8 x 32-bit                                - AVX2 vpermd
+ *        - any other pattern                         - scalar loop (also usable in constant expressions)
+ *        'in' and 'out' must not overlap
+ *
+ * @tparam Element Unsigned integral element type
+ * @tparam indexes Source index for every output element
+ */
+template <typename Element, const auto... indexes> class shuffle {
+  static_assert(std::is_integral_v<Element> && std::is_unsigned_v<Element>, "Shuffle supports only unsigned integral elements!");
+  static_assert(sizeof...(indexes), "Shuffle pattern can not be empty!");
+  static_assert((std::is_integral_v<decltype(indexes)> && ...), "Shuffle indexes should be integral!");
 
-#ifdef __cpp_concepts
-template <typename... Args>
-requires types_unique<Args...> && (var_pack::is_type_list<TestType1, TestType2, TestType3>::contains_v<Args...>)
-inline constexpr bool test_with_requires123(const Args...) {
-  return true;
-}
-#endif
+  template <typename T> inline static constexpr bool is_index_valid(const T index) {
+    return !(index < T{}) && (static_cast<std::size_t>(index) < sizeof...(indexes));
+  }
+  static_assert((is_index_valid(indexes) && ...), "Shuffle index is out of the block!");
 
-class Test {
-  // Test for no type repetition in the parameter pack
-  static_assert(var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6>, "Check the unique list 1");
-  static_assert(var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6, TestType4, TestType9, TestType7>, "Check the unique list 2");
-  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6, TestType4, TestType3, TestType7>,
-                "Check not unique in the middle 1");
-  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6, TestType2, TestType8, TestType7>,
-                "Check not unique in the middle 2");
-  static_assert(!var_pack::is_types_unique_v<TestType1, TestType6, TestType4, TestType1, TestType7>, "Check not unique in at the start 1");
-  static_assert(!var_pack::is_types_unique_v<TestType4, TestType6, TestType4, TestType5, TestType7>, "Check not unique in at the start 2");
-  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType6, TestType6>, "Check not unique in at the end 1");
-  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType7, TestType4, TestType9, TestType7>, "Check the unique end 2");
-  static_assert(unique_args(TestType1{}, TestType4::TestValue0, TestType3{}, TestType6::TestValue0), "Check the unique list with function 1");
-  static_assert(!unique_args(TestType1{}, TestType9{}, TestType3{}, TestType6{}, TestType9{}, TestType7{}), "Check the unique list with function2");
-  static_assert(unique_args(), "Check the empty unique list with function");
-#ifdef __cpp_concepts
-  static_assert(types_unique<TestType1, TestType2, TestType3, TestType6>, "Check the unique list with concept 1");
-  static_assert(!types_unique<TestType1, TestType7, TestType3, TestType4, TestType9, TestType7>, "Check the unique list with concept 2");
-#endif
+public:
+  static constexpr std::size_t size = sizeof...(indexes);
+  static constexpr std::size_t pattern[size] = {static_cast<std::size_t>(indexes)...};
 
-  // Test for no type lists (that there are required types)
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType6>::contains_v<TestType1>, "Check a type at the start of the list");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType9, TestType3, TestType6>::contains_v<TestType9>,
-                "Check a type at the middle of the list");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType9, TestType3, TestType6>::contains_v<TestType6>,
-                "Check a type at the end of the list");
-  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType9, TestType3, TestType6>::contains_v<TestType7>, "Check a wrong type");
+  static constexpr bool is_identity = []() {
+    for (std::size_t i = 0; i < size; i++) {
+      if (pattern[i] != i) {
+        return false;
+      }
+    }
+    return true;
+  }();
 
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType1, TestType4,
-                                                                                                                                TestType7, TestType8>,
-                "Check types list of types");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType7,
-                                                                                                                                TestType1, TestType4>,
-                "Check reverse types list of types");
-  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8,
-                                        TestType9>::contains_v<TestType5, TestType4, TestType7, TestType8>,
-                "Check types list of types with no type at start");
-  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8,
-                                        TestType9>::contains_v<TestType1, TestType5, TestType7, TestType8>,
-                "Check types list of types with no type at middle");
-  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8,
-                                        TestType9>::contains_v<TestType1, TestType4, TestType7, TestType5>,
-                "Check types list of types with no type at end");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType9, TestType7,
-                                                                                                                                TestType1, TestType4>,
-                "Check edges 1");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType9,
-                                                                                                                                TestType1, TestType4>,
-                "Check edges 2");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType3,
-                                                                                                                                TestType1, TestType9>,
-                "Check edges 3");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType1, TestType7,
-                                                                                                                                TestType3, TestType4>,
-                "Check edges 4");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType1,
-                                                                                                                                TestType3, TestType4>,
-                "Check edges 5");
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType3,
-                                                                                                                                TestType7, TestType1>,
-                "Check edges 6");
-  static_assert(types456inside(TestType4::TestValue2), "Check with function 1");
-  static_assert(types456inside(TestType5::TestValue0), "Check with function 2");
-  static_assert(types456inside(TestType6::TestValue1), "Check with function 3");
-  static_assert(!types456inside(TestType7{}), "Check with function 4");
-  static_assert(!types456inside(TestType7{}, TestType5::TestValue0, TestType6::TestValue3), "Check with function 5");
-  static_assert(!types456inside(TestType4::TestValue0, TestType7{}, TestType6::TestValue3), "Check with function 6");
-  static_assert(!types456inside(TestType4::TestValue1, TestType5::TestValue0, TestType7{}), "Check with function 7");
-  static_assert(types456inside(TestType4::TestValue1, TestType5::TestValue0, TestType6::TestValue3), "Check with function 8");
-  static_assert(types456inside(), "Check with function 9");
+  // Pattern that moves whole aligned dwords inside 16 bytes can use pshufd instead of pshufb
+  static constexpr bool is_dword = []() {
+    if constexpr ((4U == size) && (4U == sizeof(Element))) {
+      return true;
+    } else if constexpr ((16U == size) && (1U == sizeof(Element))) {
+      for (std::size_t i = 0; i < size; i++) {
+        if ((pattern[i] % 4U != i % 4U) || (pattern[i - i % 4U] + i % 4U != pattern[i])) {
+          return false;
+        }
+      }
+      return true;
+    } else {
+      return false;
+    }
+  }();
 
-  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3>::contains_v<TestType1, TestType3>);
+  // Immediate for pshufd (meaningful only when 'is_dword' is true)
+  static constexpr int dword_mask = []() {
+    constexpr std::size_t step = (4U == size) ? 1U : 4U;
+    int immediate = 0;
+    if constexpr (is_dword) {
+      for (std::size_t i = 0; i < 4U; i++) {
+        immediate |= static_cast<int>(pattern[i * step] / step) << (i * 2U);
+      }
+    }
+    return immediate;
+  }();
 
-#ifdef __cpp_concepts
-  static_assert(test_with_requires123(TestType1{}, TestType3{}), "Test for requires expression 1");
-  static_assert(test_with_requires123(TestType2{}), "Test for requires expression 2");
-  static_assert(test_with_requires123(), "Test for requires expression 3");
+  /**
+   * @brief Scalar implementation, the reference for the vector ones
+   *
+   * @param in  Source block of 'size' elements
+   * @param out Destination block of 'size' elements
+   */
+  inline static constexpr void apply_scalar(const Element *const in, Element *const out) {
+    for (std::size_t i = 0; i < size; i++) {
+      out[i] = in[pattern[i]];
+    }
+  }
+
+  /**
+   * @brief Shuffle the block with the cheapest available instruction
+   *
+   * @param in  Source block of 'size' elements
+   * @param out Destination block of 'size' elements
+   */
+  inline static void apply(const Element *const in, Element *const out) {
+    if constexpr (is_identity) {
+      for (std::size_t i = 0; i < size; i++) {
+        out[i] = in[i];
+      }
+    }
+#if defined(__SSE2__)
+    else if constexpr (is_dword) {
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi32(block, dword_mask));
+    }
+#endif
+#if defined(__SSSE3__)
+    else if constexpr ((16U == size) && (1U == sizeof(Element))) {
+      const __m128i mask = _mm_setr_epi8(static_cast<char>(indexes)...);
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi8(block, mask));
+    }
 #endif
+#if defined(__AVX2__)
+    else if constexpr ((8U == size) && (4U == sizeof(Element))) {
+      const __m256i mask = _mm256_setr_epi32(static_cast<int>(indexes)...);
+      const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm256_permutevar8x32_epi32(block, mask));
+    }
+#endif
+    else {
+      apply_scalar(in, out);
+    }
+  }
+};
 
-  static_assert((TestType4::TestValue2 == var_pack::type<TestType4>::get(true, TestType4::TestValue2, 367UL)), "Test for get_by_type expression 1");
-  static_assert((static_cast<TestType4>(0) == var_pack::type<TestType4>::get(true, -1, 367U)), "Test for get_by_type expression 2");
-  static_assert((TestType4::TestValue1 == var_pack::type<TestType4, TestType4::TestValue1>::get(true, -1, 367U)),
-                "Test for get_by_type expression 3");
+/**
+ * @brief Shuffle with the pattern given as a constexpr array ('const_ref_v' or any static constexpr array)
+ *
+ * @note  Usage guideline: shuffle_of<'element type', 'pattern array'>::apply('in', 'out')
+ *
+ * @tparam Element Unsigned integral element type
+ * @tparam pattern Array of source indexes
+ */
+template <typename Element, const auto &pattern> class shuffle_of {
+  template <std::size_t... I> static shuffle<Element, pattern[I]...> expand(std::index_sequence<I...>);
 
-  static_assert(var_pack::is_types_val_unique_v(TestType4::TestValue2, TestType5::TestValue1, true), "Test for get_by_type expression 1");
-  static_assert(!var_pack::is_types_val_unique_v(TestType4::TestValue2, false, TestType5::TestValue1, true), "Test for get_by_type expression 2");
-  static_assert(var_pack::is_types_val_unique_v(TestType4::TestValue2, TestType5::TestValue1, true, -36, 5743737U, TestType6::TestValue3),
+public:
+  using type = decltype(expand(std::make_index_sequence<sizeof(pattern) / sizeof(pattern[0])>{}));
+
+  inline static constexpr void apply_scalar(const Element *const in, Element *const out) { type::apply_scalar(in, out); }
+  inline static void apply(const Element *const in, Element *const out) { type::apply(in, out); }
+};
+
+// Rounding policy for 'fixed_point' when fraction bits are dropped
+enum class Rounding : bool { Truncate, Nearest };
+// Overflow policy for 'fixed_point' when the value does not fit the format
+enum class Overflow : bool { Wrap, Saturate };
+
+/**
+ * @brief Signed fixed-point number in Q'integerBits'.'fractionBits' format (sign bit is not counted)
+ *
+ * @note  Usage guideline: fixed_point<'integer bits', 'fraction bits', '[auxilary] Rounding and/or Overflow policy'>
+ *        All scale factors are folded at compile time: conversion between formats is a single shift
+ *        (plus rounding constant and/or clamp, according to the policy), no floating point is used in runtime
+ *        Default policy: Rounding::Truncate, Overflow::Saturate
+ *
+ * @tparam integerBits  Number of integer bits
+ * @tparam fractionBits Number of fraction bits
+ * @tparam params       Optional policies (unique, of types Rounding and Overflow)
+ */
+template <const unsigned integerBits, const unsigned fractionBits, const auto... params> class fixed_point {
+  static_assert(var_pack::is_types_val_unique_v(params...), "Fixed point policies should be unique!");
+  static_assert(var_pack::is_type_val_list<Rounding, Overflow>::contains_v(params...), "Only Rounding and Overflow are fixed point policies!");
+  static_assert((integerBits + fractionBits) < 32U, "Fixed point supports up to 32 bits (with sign)!");
+
+  template <const unsigned, const unsigned, const auto...> friend class fixed_point;
+
+public:
+  static constexpr unsigned INTEGER_BITS = integerBits;
+  static constexpr unsigned FRACTION_BITS = fractionBits;
+  static constexpr unsigned BITS = integerBits + fractionBits + 1U;
+  static constexpr Rounding ROUNDING_MODE = var_pack::type<Rounding>::get(params...);
+  static constexpr Overflow OVERFLOW_MODE = var_pack::type<Overflow, Overflow::Saturate>::get(params...);
+
+  // The smallest integer that fits the format
+  using storage = std::conditional_t<(BITS <= 8U), std::int8_t,
+                                     std::conditional_t<(BITS <= 16U), std::int16_t, std::int32_t>>;
+  // Integer for intermediate results
+  using wide = std::int64_t;
+
+  static constexpr wide RAW_MAX = (wide{1} << (BITS - 1U)) - 1;
+  static constexpr wide RAW_MIN = -(wide{1} << (BITS - 1U));
+  static constexpr wide ONE = wide{1} << fractionBits;
+
+private:
+  storage m_Raw;
+
+  inline static constexpr storage narrow(const wide value) {
+    if constexpr (Overflow::Saturate == OVERFLOW_MODE) {
+      return static_cast<storage>((value > RAW_MAX) ? RAW_MAX : ((value < RAW_MIN) ? RAW_MIN : value));
+    } else {
+      // Keep only the format bits and extend the sign
+      constexpr std::uint64_t mask = (std::uint64_t{1} << BITS) - 1U;
+      constexpr std::uint64_t sign = std::uint64_t{1} << (BITS - 1U);
+      const std::uint64_t bits = static_cast<std::uint64_t>(value) & mask;
+      return static_cast<storage>(static_cast<wide>((bits & sign) ? (bits | ~mask) : bits));
+    }
+  }
+
+  template <const unsigned shift> inline static constexpr wide shift_right(const wide value) {
+    if constexpr (!shift) {
+      return value;
+    } else if constexpr (Rounding::Nearest == ROUNDING_MODE) {
+      return (value + (wide{1} << (shift - 1U))) >> shift;
+    } else {
+      return value >> shift;
+    }
+  }
+
+  // Error function (the same idiom is used by the classes below): not constexpr on purpose, it is called only for the wrong input,
+  // so the constant evaluation fails with the name of the function (the reason) in the diagnostic, in runtime it gives the fallback value.
+  // Division by zero saturates to the limit with the sign of the dividend
+  inline static wide fixed_point_error_division_by_zero(const wide dividend) { return (dividend < 0) ? RAW_MIN : RAW_MAX; }
+
+  // Quotient rounded as 'shift_right': toward minus infinity or to the nearest (half up), division by zero saturates
+  // Rounding uses the remainder, so the intermediate values are not wider than the operands
+  inline static constexpr wide divide(wide dividend, wide divisor) {
+    if (!divisor) {
+      return fixed_point_error_division_by_zero(dividend);
+    }
+    if (divisor < 0) {
+      dividend = -dividend;
+      divisor = -divisor;
+    }
+    wide quotient = dividend / divisor;
+    wide remainder = dividend % divisor;
+    if (remainder < 0) {
+      quotient -= 1;
+      remainder += divisor;
+    }
+    if constexpr (Rounding::Nearest == ROUNDING_MODE) {
+      // 2 * remainder >= divisor
+      if (remainder >= divisor - remainder) {
+        quotient += 1;
+      }
+    }
+    return quotient;
+  }
+
+  struct raw_tag {};
+  constexpr fixed_point(const raw_tag, const storage raw) : m_Raw(raw) {}
+
+public:
+  constexpr fixed_point() : m_Raw(0) {}
+
+  /**
+   * @brief Construct from a compile-time constant (integral or, since C++20, floating point), e.g. const_v<3> or const_v<0.25>
+   *        Constant that does not fit the format is a compilation error
+   */
+  template <const auto value> constexpr fixed_point(const ConstValue<value>) : m_Raw(from_constant<value>()) {}
+
+  /**
+   * @brief Convert from other format: the scale factor is folded into one shift
+   *
+   * @param other Value in the source format
+   */
+  template <const unsigned otherInteger, const unsigned otherFraction, const auto... otherParams>
+  explicit constexpr fixed_point(const fixed_point<otherInteger, otherFraction, otherParams...> other) : m_Raw(convert<otherFraction>(other.m_Raw)) {}
+
+  // Create from the raw (already scaled) value
+  inline static constexpr fixed_point from_raw(const storage raw) { return fixed_point(raw_tag{}, raw); }
+  // Raw (scaled) value
+  constexpr storage raw() const { return m_Raw; }
+
+  // Value converted to the arithmetic type (for floating point - exact, for integral - rounded toward minus infinity)
+  template <typename T> constexpr T to() const {
+    if constexpr (std::is_floating_point_v<T>) {
+      return static_cast<T>(m_Raw) / static_cast<T>(ONE);
+    } else {
+      return static_cast<T>(static_cast<wide>(m_Raw) >> fractionBits);
+    }
+  }
+
+  friend constexpr fixed_point operator+(const fixed_point lhs, const fixed_point rhs) {
+    return from_raw(narrow(static_cast<wide>(lhs.m_Raw) + rhs.m_Raw));
+  }
+  friend constexpr fixed_point operator-(const fixed_point lhs, const fixed_point rhs) {
+    return from_raw(narrow(static_cast<wide>(lhs.m_Raw) - rhs.m_Raw));
+  }
+  friend constexpr fixed_point operator*(const fixed_point lhs, const fixed_point rhs) {
+    return from_raw(narrow(shift_right<fractionBits>(static_cast<wide>(lhs.m_Raw) * rhs.m_Raw)));
+  }
+  // Quotient is rounded according to the policy, division by zero is a compilation error in constant evaluation and
+  // saturates to the limit with the sign of the dividend in runtime
+  friend constexpr fixed_point operator/(const fixed_point lhs, const fixed_point rhs) {
+    return from_raw(narrow(divide(static_cast<wide>(lhs.m_Raw) * ONE, rhs.m_Raw)));
+  }
+  constexpr fixed_point operator-() const { return from_raw(narrow(-static_cast<wide>(m_Raw))); }
+
+  friend constexpr bool operator==(const fixed_point lhs, const fixed_point rhs) { return lhs.m_Raw == rhs.m_Raw; }
+  friend constexpr bool operator!=(const fixed_point lhs, const fixed_point rhs) { return lhs.m_Raw != rhs.m_Raw; }
+  friend constexpr bool operator<(const fixed_point lhs, const fixed_point rhs) { return lhs.m_Raw < rhs.m_Raw; }
+  friend constexpr bool operator>(const fixed_point lhs, const fixed_point rhs) { return lhs.m_Raw > rhs.m_Raw; }
+  friend constexpr bool operator<=(const fixed_point lhs, const fixed_point rhs) { return lhs.m_Raw <= rhs.m_Raw; }
+  friend constexpr bool operator>=(const fixed_point lhs, const fixed_point rhs) { return lhs.m_Raw >= rhs.m_Raw; }
+
+private:
+  template <const auto value> inline static constexpr storage from_constant() {
+    constexpr wide raw = []() {
+      if constexpr (std::is_floating_point_v<decltype(value)>) {
+        const auto scaled = value * static_cast<decltype(value)>(ONE);
+        // Rounded as 'shift_right': toward minus infinity or to the nearest (half up)
+        const auto rounded = (Rounding::Nearest == ROUNDING_MODE) ? scaled + static_cast<decltype(value)>(0.5) : scaled;
+        const wide truncated = static_cast<wide>(rounded);
+        return (static_cast<decltype(value)>(truncated) > rounded) ? truncated - 1 : truncated;
+      } else {
+        static_assert(std::is_integral_v<decltype(value)>, "Only arithmetic constants can be fixed point!");
+        return static_cast<wide>(value) * ONE;
+      }
+    }();
+    static_assert((raw <= RAW_MAX) && (raw >= RAW_MIN), "Constant does not fit the fixed point format!");
+    return static_cast<storage>(raw);
+  }
+
+  template <const unsigned sourceFraction> inline static constexpr storage convert(const wide raw) {
+    if constexpr (sourceFraction > fractionBits) {
+      return narrow(shift_right<sourceFraction - fractionBits>(raw));
+    } else {
+      return narrow(raw * (wide{1} << (fractionBits - sourceFraction)));
+    }
+  }
+};
+
+/**
+ * @brief Base dimensions for 'dimension', the enumerator value is the exponent (e.g. dim::Length{2} is area)
+ */
+struct dim {
+  enum class Length : int {};
+  enum class Mass : int {};
+  enum class Time : int {};
+  enum class Current : int {};
+  enum class Temperature : int {};
+  enum class Amount : int {};
+  enum class Luminosity : int {};
+};
+
+/**
+ * @brief Physical dimension as a pack of base dimension exponents (missed base dimensions have zero exponent)
+ *
+ * @note  Usage guideline: dimension<'dim::Base{exponent}...'>, e.g. speed is dimension<dim::Length{1}, dim::Time{-1}>
+ *        Exponents are validated and extracted with var_pack, so they are unique and can be given in any order
+ *
+ * @tparam exponents Unique exponents of the base dimensions
+ */
+template <const auto... exponents> struct dimension {
+  static_assert(var_pack::is_types_val_unique_v(exponents...), "Base dimensions should be unique!");
+  static_assert(var_pack::is_type_val_list<dim::Length, dim::Mass, dim::Time, dim::Current, dim::Temperature, dim::Amount,
+                                           dim::Luminosity>::contains_v(exponents...),
+                "Only base dimensions from 'dim' are allowed!");
+
+  static constexpr int LENGTH = static_cast<int>(var_pack::type<dim::Length>::get(exponents...));
+  static constexpr int MASS = static_cast<int>(var_pack::type<dim::Mass>::get(exponents...));
+  static constexpr int TIME = static_cast<int>(var_pack::type<dim::Time>::get(exponents...));
+  static constexpr int CURRENT = static_cast<int>(var_pack::type<dim::Current>::get(exponents...));
+  static constexpr int TEMPERATURE = static_cast<int>(var_pack::type<dim::Temperature>::get(exponents...));
+  static constexpr int AMOUNT = static_cast<int>(var_pack::type<dim::Amount>::get(exponents...));
+  static constexpr int LUMINOSITY = static_cast<int>(var_pack::type<dim::Luminosity>::get(exponents...));
+
+  // The same dimension with all exponents in the fixed order, so equal dimensions are the same type
+  using canonical = dimension<dim::Length{LENGTH}, dim::Mass{MASS}, dim::Time{TIME}, dim::Current{CURRENT}, dim::Temperature{TEMPERATURE},
+                              dim::Amount{AMOUNT}, dim::Luminosity{LUMINOSITY}>;
+
+  // Dimension of the product (sign = 1) or quotient (sign = -1)
+  template <typename Other, const int sign = 1>
+  using combine = dimension<dim::Length{LENGTH + sign * Other::LENGTH}, dim::Mass{MASS + sign * Other::MASS}, dim::Time{TIME + sign * Other::TIME},
+                            dim::Current{CURRENT + sign * Other::CURRENT}, dim::Temperature{TEMPERATURE + sign * Other::TEMPERATURE},
+                            dim::Amount{AMOUNT + sign * Other::AMOUNT}, dim::Luminosity{LUMINOSITY + sign * Other::LUMINOSITY}>;
+};
+
+/**
+ * @brief Dimensioned quantity: the value in units of 'num'/'den' of the coherent unit of 'Dim'
+ *
+ * @note  Usage guideline: quantity<'representation', dimension<...>, '[auxilary] ratio numerator', '[auxilary] ratio denominator'>
+ *        Same-unit operations work with the raw representation only. Conversion between units of the same dimension
+ *        is folded to one rational constant at compile time, so it is a single multiply (or division) and
+ *        a dimension mismatch is compilation error
+ *
+ * @tparam Rep Arithmetic type of the value
+ * @tparam Dim Dimension of the quantity
+ * @tparam num Numerator of the unit ratio
+ * @tparam den Denominator of the unit ratio
+ */
+template <typename Rep, typename Dim, const std::intmax_t num = 1, const std::intmax_t den = 1> class quantity {
+  static_assert(std::is_arithmetic_v<Rep>, "Quantity representation should be arithmetic!");
+  static_assert((num > 0) && (den > 0), "Unit ratio should be positive!");
+
+  inline static constexpr std::intmax_t gcd(const std::intmax_t a, const std::intmax_t b) { return b ? gcd(b, a % b) : a; }
+
+  Rep m_Value;
+
+public:
+  using rep = Rep;
+  using dimension_type = typename Dim::canonical;
+  static constexpr std::intmax_t NUM = num / gcd(num, den);
+  static constexpr std::intmax_t DEN = den / gcd(num, den);
+
+  /**
+   * @brief Folded factor to convert the value from 'From' unit to this unit (value * FACTOR_NUM / FACTOR_DEN)
+   *
+   * @tparam From Source quantity
+   */
+  template <typename From> struct conversion {
+    static_assert(std::is_same_v<dimension_type, typename From::dimension_type>, "Conversion between different dimensions!");
+
+  private:
+    static constexpr std::intmax_t numerator = From::NUM * DEN;
+    static constexpr std::intmax_t denominator = From::DEN * NUM;
+
+  public:
+    static constexpr std::intmax_t FACTOR_NUM = numerator / gcd(numerator, denominator);
+    static constexpr std::intmax_t FACTOR_DEN = denominator / gcd(numerator, denominator);
+
+    inline static constexpr Rep apply(const typename From::rep value) {
+      if constexpr ((1 == FACTOR_NUM) && (1 == FACTOR_DEN)) {
+        return static_cast<Rep>(value);
+      } else if constexpr (std::is_floating_point_v<Rep>) {
+        constexpr Rep factor = static_cast<Rep>(FACTOR_NUM) / static_cast<Rep>(FACTOR_DEN);
+        return static_cast<Rep>(value) * factor;
+      } else if constexpr (1 == FACTOR_DEN) {
+        return static_cast<Rep>(value * FACTOR_NUM);
+      } else if constexpr (1 == FACTOR_NUM) {
+        return static_cast<Rep>(value / FACTOR_DEN);
+      } else {
+        return static_cast<Rep>(value * FACTOR_NUM / FACTOR_DEN);
+      }
+    }
+  };
+
+  constexpr quantity() : m_Value() {}
+  explicit constexpr quantity(const Rep value) : m_Value(value) {}
+  // Construct from the compile-time constant, e.g. const_v<5>
+  template <const auto value> explicit constexpr quantity(const ConstValue<value>) : m_Value(static_cast<Rep>(value)) {}
+
+  // Convert from other unit of the same dimension
+  template <typename OtherRep, typename OtherDim, const std::intmax_t otherNum, const std::intmax_t otherDen>
+  explicit constexpr quantity(const quantity<OtherRep, OtherDim, otherNum, otherDen> other)
+      : m_Value(conversion<quantity<OtherRep, OtherDim, otherNum, otherDen>>::apply(other.count())) {}
+
+  // Value in the units of this quantity
+  constexpr Rep count() const { return m_Value; }
+
+  friend constexpr quantity operator+(const quantity lhs, const quantity rhs) { return quantity(lhs.m_Value + rhs.m_Value); }
+  friend constexpr quantity operator-(const quantity lhs, const quantity rhs) { return quantity(lhs.m_Value - rhs.m_Value); }
+  friend constexpr quantity operator*(const quantity lhs, const Rep rhs) { return quantity(lhs.m_Value * rhs); }
+  friend constexpr quantity operator*(const Rep lhs, const quantity rhs) { return quantity(lhs * rhs.m_Value); }
+  friend constexpr quantity operator/(const quantity lhs, const Rep rhs) { return quantity(lhs.m_Value / rhs); }
+  constexpr quantity operator-() const { return quantity(-m_Value); }
+
+  friend constexpr bool operator==(const quantity lhs, const quantity rhs) { return lhs.m_Value == rhs.m_Value; }
+  friend constexpr bool operator!=(const quantity lhs, const quantity rhs) { return lhs.m_Value != rhs.m_Value; }
+  friend constexpr bool operator<(const quantity lhs, const quantity rhs) { return lhs.m_Value < rhs.m_Value; }
+  friend constexpr bool operator>(const quantity lhs, const quantity rhs) { return lhs.m_Value > rhs.m_Value; }
+  friend constexpr bool operator<=(const quantity lhs, const quantity rhs) { return lhs.m_Value <= rhs.m_Value; }
+  friend constexpr bool operator>=(const quantity lhs, const quantity rhs) { return lhs.m_Value >= rhs.m_Value; }
+
+  template <typename OtherDim, const std::intmax_t otherNum, const std::intmax_t otherDen>
+  constexpr auto operator*(const quantity<Rep, OtherDim, otherNum, otherDen> rhs) const {
+    return quantity<Rep, typename dimension_type::template combine<OtherDim>, NUM * otherNum, DEN * otherDen>(m_Value * rhs.count());
+  }
+
+  template <typename OtherDim, const std::intmax_t otherNum, const std::intmax_t otherDen>
+  constexpr auto operator/(const quantity<Rep, OtherDim, otherNum, otherDen> rhs) const {
+    return quantity<Rep, typename dimension_type::template combine<OtherDim, -1>, NUM * otherDen, DEN * otherNum>(m_Value / rhs.count());
+  }
+};
+
+/**
+ * @brief Small fixed-size matrix: all sizes are compile-time values, so the kernels are unrolled by the sizes
+ *        and dimension mismatch is a compilation error
+ *
+ * @note  Usage guideline: matrix<'element type', 'rows', 'columns'>{{{row 0...}, {row 1...}, ...}}
+ *        The class is an aggregate with row-major storage and can be used in constant expressions
+ *
+ * @tparam T    Arithmetic element type
+ * @tparam rows Number of rows
+ * @tparam cols Number of columns
+ */
+template <typename T, const std::size_t rows, const std::size_t cols> struct matrix {
+  static_assert(std::is_arithmetic_v<T>, "Matrix element should be arithmetic!");
+  static_assert(rows && cols, "Matrix can not be empty!");
+
+  static constexpr std::size_t ROWS = rows;
+  static constexpr std::size_t COLS = cols;
+
+  T data[rows][cols];
+
+  constexpr T &operator()(const std::size_t row, const std::size_t col) { return data[row][col]; }
+  constexpr const T &operator()(const std::size_t row, const std::size_t col) const { return data[row][col]; }
+
+  // Identity matrix
+  inline static constexpr matrix identity() {
+    static_assert(rows == cols, "Identity matrix should be square!");
+    return generate([](const matrix &, const std::size_t row, const std::size_t col) { return (row == col) ? T{1} : T{0}; }, matrix{});
+  }
+
+  constexpr matrix<T, cols, rows> transpose() const {
+    return matrix<T, cols, rows>::generate([](const matrix &m, const std::size_t row, const std::size_t col) { return m.data[col][row]; }, *this);
+  }
+
+  friend constexpr matrix operator+(const matrix &lhs, const matrix &rhs) {
+    return lhs.zip(rhs, [](const T a, const T b) { return a + b; }, std::make_index_sequence<rows * cols>{});
+  }
+  friend constexpr matrix operator-(const matrix &lhs, const matrix &rhs) {
+    return lhs.zip(rhs, [](const T a, const T b) { return a - b; }, std::make_index_sequence<rows * cols>{});
+  }
+  friend constexpr matrix operator*(const matrix &lhs, const T rhs) {
+    return lhs.zip(lhs, [rhs](const T a, const T) { return a * rhs; }, std::make_index_sequence<rows * cols>{});
+  }
+  friend constexpr matrix operator*(const T lhs, const matrix &rhs) { return rhs * lhs; }
+
+  /**
+   * @brief Matrix product, fully unrolled by the compile-time sizes
+   *
+   * @param rhs Matrix with 'cols' rows
+   */
+  template <const std::size_t rhsRows, const std::size_t rhsCols> constexpr matrix<T, rows, rhsCols> operator*(const matrix<T, rhsRows, rhsCols> &rhs) const {
+    static_assert(cols == rhsRows, "Matrix dimensions mismatch for the product!");
+    return multiply(rhs, std::make_index_sequence<rows * rhsCols>{});
+  }
+
+  friend constexpr bool operator==(const matrix &lhs, const matrix &rhs) {
+    for (std::size_t i = 0; i < rows * cols; i++) {
+      if (lhs.data[i / cols][i % cols] != rhs.data[i / cols][i % cols]) {
+        return false;
+      }
+    }
+    return true;
+  }
+  friend constexpr bool operator!=(const matrix &lhs, const matrix &rhs) { return !(lhs == rhs); }
+
+  // Build the matrix element by element from 'source' with 'function(source, row, col)'
+  template <typename Function, typename Source> inline static constexpr matrix generate(const Function function, const Source &source) {
+    return generate(function, source, std::make_index_sequence<rows * cols>{});
+  }
+
+private:
+  template <typename Function, typename Source, std::size_t... I>
+  inline static constexpr matrix generate(const Function function, const Source &source, std::index_sequence<I...>) {
+    matrix result{};
+    ((result.data[I / cols][I % cols] = function(source, I / cols, I % cols)), ...);
+    return result;
+  }
+
+  template <typename Function, std::size_t... I> constexpr matrix zip(const matrix &rhs, const Function function, std::index_sequence<I...>) const {
+    matrix result{};
+    ((result.data[I / cols][I % cols] = function(data[I / cols][I % cols], rhs.data[I / cols][I % cols])), ...);
+    return result;
+  }
+
+  template <const std::size_t rhsCols, std::size_t... K>
+  constexpr T dot(const matrix<T, cols, rhsCols> &rhs, const std::size_t row, const std::size_t col, std::index_sequence<K...>) const {
+    return ((data[row][K] * rhs.data[K][col]) + ...);
+  }
+
+  template <const std::size_t rhsCols, std::size_t... I>
+  constexpr matrix<T, rows, rhsCols> multiply(const matrix<T, cols, rhsCols> &rhs, std::index_sequence<I...>) const {
+    matrix<T, rows, rhsCols> result{};
+    ((result.data[I / rhsCols][I % rhsCols] = dot(rhs, I / rhsCols, I % rhsCols, std::make_index_sequence<cols>{})), ...);
+    return result;
+  }
+};
+
+// Column vector
+template <typename T, const std::size_t size> using vec = matrix<T, size, 1>;
+
+/**
+ * @brief LDL^T factorization of a symmetric matrix (square root free, so usable in constant expressions)
+ *
+ * @note  Usage guideline: const auto factor = ldlt<T, size>(a); const auto x = factor.solve(b);
+ *        Suitable for covariance-like (symmetric positive definite) matrices of state estimators.
+ *        Non-positive (or NaN) pivot stops the factorization and clears 'valid', so singular or indefinite input gives no inf/NaN;
+ *        solve() with such factor is a compilation error in constant evaluation and returns zero vector in runtime
+ *
+ * @tparam T    Floating point element type
+ * @tparam size Size of the square matrix
+ */
+template <typename T, const std::size_t size> struct ldlt {
+  static_assert(std::is_floating_point_v<T>, "LDL^T factorization supports only floating point!");
+
+  matrix<T, size, size> l; // Unit lower triangular factor
+  vec<T, size> d;          // Diagonal factor
+  bool valid;              // All pivots are positive (the matrix is positive definite)
+
+  explicit constexpr ldlt(const matrix<T, size, size> &a) : l(matrix<T, size, size>::identity()), d{}, valid(true) {
+    for (std::size_t j = 0; j < size; j++) {
+      T dj = a(j, j);
+      for (std::size_t k = 0; k < j; k++) {
+        dj -= l(j, k) * l(j, k) * d(k, 0);
+      }
+      d(j, 0) = dj;
+      if (!(dj > T{0})) {
+        valid = false;
+        return;
+      }
+      for (std::size_t i = j + 1; i < size; i++) {
+        T lij = a(i, j);
+        for (std::size_t k = 0; k < j; k++) {
+          lij -= l(i, k) * l(j, k) * d(k, 0);
+        }
+        l(i, j) = lij / dj;
+      }
+    }
+  }
+
+  // Solve A * x = b with the factorization
+  constexpr vec<T, size> solve(const vec<T, size> &b) const {
+    if (!valid) {
+      return ldlt_error_matrix_is_not_positive_definite();
+    }
+    vec<T, size> x = b;
+    for (std::size_t i = 0; i < size; i++) {
+      for (std::size_t k = 0; k < i; k++) {
+        x(i, 0) -= l(i, k) * x(k, 0);
+      }
+    }
+    for (std::size_t i = 0; i < size; i++) {
+      x(i, 0) /= d(i, 0);
+    }
+    for (std::size_t i = size; i-- > 0;) {
+      for (std::size_t k = i + 1; k < size; k++) {
+        x(i, 0) -= l(k, i) * x(k, 0);
+      }
+    }
+    return x;
+  }
+
+private:
+  inline static vec<T, size> ldlt_error_matrix_is_not_positive_definite() { return {}; }
+};
+
+// Byte order of the data
+enum class Endian : bool { Little, Big };
+// Byte order of the target
+inline constexpr Endian native_endian = (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__) ? Endian::Big : Endian::Little;
+
+// Unsigned integer with the same size as the integral or enumeration type
+template <typename T>
+using raw_bits_t = std::make_unsigned_t<typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type>;
+
+/**
+ * @brief Reverse the byte order of integral or enumeration value
+ *
+ * @note  Expression is unrolled by the bytes, so compilers emit a single bswap for it
+ *
+ * @param value Value to swap
+ * @return Value with reversed byte order
+ */
+template <typename T, std::size_t... I> inline constexpr T byte_swap(const T value, std::index_sequence<I...>) {
+  static_assert((std::is_integral_v<T> || std::is_enum_v<T>) && !std::is_same_v<T, bool>, "Only integral and enumeration values can be swapped!");
+  const auto bits = static_cast<raw_bits_t<T>>(value);
+  return static_cast<T>(static_cast<raw_bits_t<T>>(((((bits >> (8U * I)) & 0xFFU) << (8U * (sizeof(T) - 1U - I))) | ...)));
+}
+template <typename T> inline constexpr T byte_swap(const T value) { return byte_swap(value, std::make_index_sequence<sizeof(T)>{}); }
+
+/**
+ * @brief Convert the value from the native byte order to 'endian' (and back - the operation is symmetric)
+ *
+ * @note  Usage guideline: to_endian<'target byte order'>('value') - no operation when the target is native
+ *
+ * @tparam endian Target byte order
+ */
+template <const Endian endian, typename T> inline constexpr T to_endian(const T value) {
+  if constexpr (native_endian == endian) {
+    return value;
+  } else {
+    return byte_swap(value);
+  }
+}
+
+/**
+ * @brief Compile-time byte order conversion of the constant array: the converted copy is a constant (.rodata) table
+ *
+ * @note  Usage guideline: endian_array<'target byte order', 'array'>::value
+ *        When the target byte order is native, 'value' is the original array itself (no copy)
+ *
+ * @tparam endian Target byte order
+ * @tparam array  Constant array of integral or enumeration values
+ */
+template <const Endian endian, const auto &array> class endian_array {
+  using Array = std::remove_cv_t<std::remove_reference_t<decltype(array)>>;
+  static_assert(std::is_array_v<Array> && (1U == std::rank_v<Array>), "Only one-dimension arrays can be converted!");
+  using Element = std::remove_cv_t<std::remove_extent_t<Array>>;
+
+  template <typename Sequence> struct table;
+  template <std::size_t... I> struct table<std::index_sequence<I...>> {
+    static constexpr Element value[] = {to_endian<endian>(array[I])...};
+  };
+
+public:
+  static constexpr auto &value = []() -> auto & {
+    if constexpr (native_endian == endian) {
+      return array;
+    } else {
+      return table<std::make_index_sequence<std::extent_v<Array>>>::value;
+    }
+  }();
+};
+
+// Constant in the target byte order as a real const
+template <const Endian endian, const auto value> inline constexpr auto endian_v = const_v<to_endian<endian>(value)>;
+// Constant array in the target byte order as a real const reference
+template <const Endian endian, const auto &array> inline constexpr auto endian_ref_v = const_ref_v<endian_array<endian, array>::value>;
+
+/**
+ * @brief Byte order conversion of 'const_v' and 'const_ref_v' parameters
+ *
+ * @note  Usage guideline: to_endian<'target byte order'>(const_v<'value'>) or to_endian<'target byte order'>(const_ref_v<'array'>)
+ */
+template <const Endian endian, const auto value> inline constexpr auto to_endian(const ConstValue<value>) { return endian_v<endian, value>; }
+template <const Endian endian, const auto &array> inline constexpr auto to_endian(const ConstReference<array>) { return endian_ref_v<endian, array>; }
+
+/**
+ * @brief Field of the binary message: value type, compile-time offset and byte order
+ *
+ * @note  The value type is also the field identifier, so it should be unique inside the message (strong types/enumerations)
+ *
+ * @tparam T      Integral or enumeration value type
+ * @tparam offset Offset of the field in bytes
+ * @tparam endian Byte order of the field
+ */
+template <typename T, const std::size_t offset, const Endian endian = Endian::Little> class field {
+  static_assert((std::is_integral_v<T> || std::is_enum_v<T>) && !std::is_same_v<T, bool>, "Only integral and enumeration fields are supported!");
+
+  using Bits = raw_bits_t<T>;
+
+  // Byte shift of the byte 'index' inside the value
+  inline static constexpr std::size_t shift(const std::size_t index) { return 8U * ((Endian::Little == endian) ? index : (sizeof(T) - 1U - index)); }
+
+  // Byte-wise unrolled access is recognized by compilers as a single (byte swapping) load/store and keeps it constexpr
+  template <std::size_t... I> inline static constexpr T load(const std::byte *const data, std::index_sequence<I...>) {
+    return static_cast<T>(static_cast<Bits>(((static_cast<Bits>(std::to_integer<unsigned char>(data[offset + I])) << shift(I)) | ...)));
+  }
+
+  template <std::size_t... I> inline static constexpr void store(std::byte *const data, const Bits bits, std::index_sequence<I...>) {
+    ((data[offset + I] = static_cast<std::byte>(bits >> shift(I))), ...);
+  }
+
+public:
+  using type = T;
+  static constexpr std::size_t OFFSET = offset;
+  static constexpr std::size_t SIZE = sizeof(T);
+  static constexpr Endian ENDIAN = endian;
+  static constexpr std::size_t BIT_OFFSET = offset * 8U;
+  static constexpr std::size_t BIT_WIDTH = SIZE * 8U;
+
+  inline static constexpr T load(const std::byte *const data) { return load(data, std::make_index_sequence<SIZE>{}); }
+  inline static constexpr void store(std::byte *const data, const T value) { store(data, static_cast<Bits>(value), std::make_index_sequence<SIZE>{}); }
+};
+
+/**
+ * @brief Sub-byte (or multi-byte) bit field of the binary message
+ *
+ * @note  Bytes covered by the field are read as one window in the given byte order, so access is a single load plus shift/mask.
+ *        Bits are numbered in the order of the byte order: from MSB of the first byte for Endian::Big (network headers)
+ *        and from LSB of the first byte for Endian::Little. Width and the window are validated at compile time
+ *
+ * @tparam T         Unsigned integral, bool or enumeration value type
+ * @tparam bitOffset Offset of the field in bits
+ * @tparam bitWidth  Width of the field in bits
+ * @tparam endian    Byte order of the window
+ */
+template <typename T, const std::size_t bitOffset, const std::size_t bitWidth, const Endian endian = Endian::Big> class bit_field {
+  static_assert((std::is_integral_v<T> && std::is_unsigned_v<T>) || std::is_enum_v<T>, "Only unsigned, bool and enumeration bit fields are supported!");
+  static_assert(bitWidth && (bitWidth <= 8U * sizeof(T)), "Bit field width does not fit the value type!");
+
+  static constexpr std::size_t LAST = (bitOffset + bitWidth - 1U) / 8U;
+  static constexpr std::size_t USED = LAST - bitOffset / 8U + 1U;
+  static_assert(USED <= sizeof(std::uint64_t), "Bit field window should fit 64 bits!");
+
+  // Window of odd size is extended back to the power of two (when there are bytes before) to be loaded at once
+  static constexpr std::size_t POWER = (USED <= 1U) ? 1U : ((USED <= 2U) ? 2U : ((USED <= 4U) ? 4U : 8U));
+  static constexpr std::size_t FIRST = (LAST + 1U >= POWER) ? (LAST + 1U - POWER) : (bitOffset / 8U);
+  static constexpr std::size_t SPAN = LAST - FIRST + 1U;
+
+  using Window = std::conditional_t<(SPAN <= 1U), std::uint8_t,
+                                    std::conditional_t<(SPAN <= 2U), std::uint16_t, std::conditional_t<(SPAN <= 4U), std::uint32_t, std::uint64_t>>>;
+
+  static constexpr std::size_t SHIFT = (Endian::Big == endian) ? (SPAN * 8U - (bitOffset - FIRST * 8U) - bitWidth) : (bitOffset - FIRST * 8U);
+  static constexpr Window MASK = static_cast<Window>(((bitWidth < 64U) ? ((std::uint64_t{1} << bitWidth) - 1U) : ~std::uint64_t{0}) << SHIFT);
+
+  inline static constexpr std::size_t shift(const std::size_t index) { return 8U * ((Endian::Little == endian) ? index : (SPAN - 1U - index)); }
+
+  template <std::size_t... I> inline static constexpr Window window(const std::byte *const data, std::index_sequence<I...>) {
+    return static_cast<Window>(((static_cast<Window>(std::to_integer<unsigned char>(data[FIRST + I])) << shift(I)) | ...));
+  }
+
+  template <std::size_t... I> inline static constexpr void store(std::byte *const data, const Window bits, std::index_sequence<I...>) {
+    ((data[FIRST + I] = static_cast<std::byte>(bits >> shift(I))), ...);
+  }
+
+public:
+  using type = T;
+  static constexpr Endian ENDIAN = endian;
+  static constexpr std::size_t BIT_OFFSET = bitOffset;
+  static constexpr std::size_t BIT_WIDTH = bitWidth;
+
+  inline static constexpr T load(const std::byte *const data) {
+    return static_cast<T>((window(data, std::make_index_sequence<SPAN>{}) & MASK) >> SHIFT);
+  }
+
+  // Read-modify-write of the window, the rest bits are kept
+  inline static constexpr void store(std::byte *const data, const T value) {
+    const Window rest = static_cast<Window>(window(data, std::make_index_sequence<SPAN>{}) & static_cast<Window>(~MASK));
+    store(data, static_cast<Window>(rest | (static_cast<Window>(static_cast<Window>(value) << SHIFT) & MASK)), std::make_index_sequence<SPAN>{});
+  }
+};
+
+/**
+ * @brief Binary message schema as a list of fields
+ *
+ * @note  Usage guideline: schema<field<...>...>::encode('buffer', 'values...') and schema<field<...>...>::decode('buffer').get<'type'>()
+ *        Fields are 'field' and/or 'bit_field' descriptors (there is no runtime layout table).
+ *        Field uniqueness, overlapping (at bit level) and the total size are checked/computed at compile time.
+ *        Encode takes values in any order (missed fields are zero), decode returns a zero-copy view over the buffer.
+ *        Buffer should be at least 'SIZE' bytes - that is the only check left for the runtime (on the caller side)
+ *
+ * @tparam Fields Fields of the message
+ */
+template <typename... Fields> class schema {
+  static_assert(sizeof...(Fields), "Schema should have at least one field!");
+  static_assert(var_pack::is_types_unique_v<typename Fields::type...>, "Field types should be unique inside the schema!");
+
+  static constexpr std::size_t offsets[] = {Fields::BIT_OFFSET...};
+  static constexpr std::size_t widths[] = {Fields::BIT_WIDTH...};
+
+  static_assert(
+      []() {
+        for (std::size_t i = 0; i < sizeof...(Fields); i++) {
+          for (std::size_t j = i + 1U; j < sizeof...(Fields); j++) {
+            if ((offsets[i] < offsets[j] + widths[j]) && (offsets[j] < offsets[i] + widths[i])) {
+              return false;
+            }
+          }
+        }
+        return true;
+      }(),
+      "Schema fields are overlapped!");
+
+  template <typename T, typename... Rest> struct field_of;
+  template <typename T, typename First, typename... Rest> struct field_of<T, First, Rest...> {
+    using type = typename std::conditional_t<std::is_same_v<T, typename First::type>, std::common_type<First>, field_of<T, Rest...>>::type;
+  };
+
+public:
+  // Total size of the message in bytes
+  static constexpr std::size_t SIZE = []() {
+    std::size_t bits = 0;
+    for (std::size_t i = 0; i < sizeof...(Fields); i++) {
+      bits = (offsets[i] + widths[i] > bits) ? offsets[i] + widths[i] : bits;
+    }
+    return (bits + 7U) / 8U;
+  }();
+
+  /**
+   * @brief Read the field of type 'T' from the message
+   *
+   * @param data Message buffer
+   */
+  template <typename T> inline static constexpr T get(const std::byte *const data) {
+    static_assert(var_pack::is_type_list<typename Fields::type...>::template contains_v<T>, "No such field in the schema!");
+    return field_of<T, Fields...>::type::load(data);
+  }
+
+  /**
+   * @brief Write the field of type 'T' to the message
+   *
+   * @param data  Message buffer
+   * @param value Value of the field
+   */
+  template <typename T> inline static constexpr void set(std::byte *const data, const T value) {
+    static_assert(var_pack::is_type_list<typename Fields::type...>::template contains_v<T>, "No such field in the schema!");
+    field_of<T, Fields...>::type::store(data, value);
+  }
+
+  /**
+   * @brief Encode the whole message
+   *
+   * @param data   Message buffer
+   * @param values Unique values of the schema types in any order (missed fields are written as zero)
+   */
+  template <typename... Values> inline static constexpr void encode(std::byte *const data, const Values... values) {
+    static_assert(var_pack::is_types_unique_v<Values...>, "Encoded values should be unique!");
+    static_assert(var_pack::is_type_list<typename Fields::type...>::template contains_v<Values...>, "Value is not a field of the schema!");
+    (Fields::store(data, var_pack::type<typename Fields::type>::get(values...)), ...);
+  }
+
+  // Zero-copy view over the encoded message
+  class view {
+    const std::byte *m_Data;
+
+  public:
+    explicit constexpr view(const std::byte *const data) : m_Data(data) {}
+    template <typename T> constexpr T get() const { return schema::get<T>(m_Data); }
+    constexpr const std::byte *data() const { return m_Data; }
+  };
+
+  inline static constexpr view decode(const std::byte *const data) { return view(data); }
+};
+
+// Type as a value (for generic lambdas and overloading)
+template <typename T> struct type_tag {
+  using type = T;
+};
+
+/**
+ * @brief List of types
+ *
+ * @note  Usage guideline: type_list<'types...'>::for_each('function') calls 'function(type_tag<T>{})' for every type in the order
+ *        type_list<'types...'>::is_unique() and type_list<'types...'>::is_subset_of_v<'list...'> validate the types with var_pack
+ *
+ * @tparam Types Types of the list
+ */
+template <typename... Types> struct type_list {
+  static constexpr std::size_t size = sizeof...(Types);
+
+  template <typename Function> inline static constexpr void for_each(Function &&function) { (function(type_tag<Types>{}), ...); }
+
+  // Types as the arguments of the template
+  template <template <typename...> class Template> using apply = Template<Types...>;
+
+  // Validation with var_pack: all types are unique and all types belong to the list
+  inline static constexpr bool is_unique() { return var_pack::is_types_unique_v<Types...>; }
+  template <typename... List> static constexpr bool is_subset_of_v = var_pack::is_type_list<List...>::template contains_v<Types...>;
+};
+
+// Concatenation of the type lists
+template <typename... Lists> struct type_list_cat {
+  using type = type_list<>;
+};
+template <typename... Types> struct type_list_cat<type_list<Types...>> {
+  using type = type_list<Types...>;
+};
+template <typename... First, typename... Second, typename... Rest> struct type_list_cat<type_list<First...>, type_list<Second...>, Rest...> {
+  using type = typename type_list_cat<type_list<First..., Second...>, Rest...>::type;
+};
+template <typename... Lists> using type_list_cat_t = typename type_list_cat<Lists...>::type;
+
+/**
+ * @brief Compile-time dependency graph of components
+ *
+ * @note  Usage guideline: dependency_graph<'components...'>::initialize() or dependency_graph<'components...'>::for_each_level('function')
+ *        Every component declares the dependencies as a member 'using dependencies = type_list<...>' (no member - no dependencies).
+ *        Components should be unique, dependencies should be in the graph (checked with var_pack) and cycles are compile-time error.
+ *        Components are sorted into levels: level 0 has no dependencies, level N depends only on the lower levels,
+ *        so components of the same level can be initialized concurrently (host threads, overlapped DMA and so on)
+ *
+ * @tparam Components Unique component types
+ */
+template <typename... Components> class dependency_graph {
+  static_assert(var_pack::is_types_unique_v<Components...>, "Components of the graph should be unique!");
+
+protected:
+  // Dependencies declared by the component (empty list if there is no member)
+  template <typename T, typename U = void> struct dependencies_of {
+    using type = type_list<>;
+  };
+  template <typename T> struct dependencies_of<T, std::void_t<typename T::dependencies>> {
+    using type = typename T::dependencies;
+  };
+
+private:
+  template <typename... Dependencies> inline static constexpr bool is_known(const type_list<Dependencies...>) {
+    return var_pack::is_types_unique_v<Dependencies...> && var_pack::is_type_list<Components...>::template contains_v<Dependencies...>;
+  }
+  static_assert((is_known(typename dependencies_of<Components>::type{}) && ...), "Dependencies should be unique components of the graph!");
+
+  static constexpr std::size_t size = sizeof...(Components);
+
+  template <typename T> static constexpr std::size_t index_of = []() {
+    constexpr bool same[] = {std::is_same_v<T, Components>...};
+    std::size_t index = 0;
+    while (!same[index]) {
+      index++;
+    }
+    return index;
+  }();
+
+  // Mark the component dependencies in the matrix [dependency][component]
+  template <typename... Dependencies>
+  inline static constexpr std::size_t mark([[maybe_unused]] bool (&graph)[size][size], [[maybe_unused]] const std::size_t component,
+                                           const type_list<Dependencies...>) {
+    ((graph[index_of<Dependencies>][component] = true), ...);
+    return sizeof...(Dependencies);
+  }
+
+  static constexpr std::size_t edges = (std::size_t{0} + ... + dependencies_of<Components>::type::size);
+
+public:
+  /**
+   * @brief Resolved graph (indexes are the positions of the components in the parameter pack)
+   *        Kahn's algorithm over the adjacency matrix in a constant expression
+   */
+  struct structure {
+    std::size_t level[size];        // Level of the component ('size' - not resolved, i.e. in a cycle)
+    std::size_t sequence[size];     // Components in the topological order
+    std::size_t dependencies[size]; // Number of dependencies of the component
+    std::size_t first[size + 1U];   // Successors of the component 'i' are 'successors[first[i]]'...'successors[first[i + 1] - 1]'
+    std::size_t successors[edges ? edges : 1U];
+  };
+
+  static constexpr structure resolved = []() {
+    bool graph[size][size] = {};
+    std::size_t index = 0;
+    std::size_t remaining[size] = {mark(graph, index++, typename dependencies_of<Components>::type{})...};
+
+    structure result{};
+    std::size_t edge_count = 0;
+    for (std::size_t dependency = 0; dependency < size; dependency++) {
+      result.dependencies[dependency] = remaining[dependency];
+      result.first[dependency] = edge_count;
+      for (std::size_t successor = 0; successor < size; successor++) {
+        if (graph[dependency][successor]) {
+          result.successors[edge_count++] = successor;
+        }
+      }
+    }
+    result.first[size] = edge_count;
+
+    std::size_t tail = 0;
+    for (std::size_t component = 0; component < size; component++) {
+      result.level[component] = remaining[component] ? size : 0U;
+      if (!remaining[component]) {
+        result.sequence[tail++] = component;
+      }
+    }
+    for (std::size_t head = 0; head < tail; head++) {
+      const std::size_t dependency = result.sequence[head];
+      for (std::size_t edge = result.first[dependency]; edge < result.first[dependency + 1U]; edge++) {
+        const std::size_t component = result.successors[edge];
+        if (!--remaining[component]) {
+          std::size_t level = 0;
+          for (std::size_t other = 0; other < size; other++) {
+            level = (graph[other][component] && (result.level[other] + 1U > level)) ? result.level[other] + 1U : level;
+          }
+          result.level[component] = level;
+          result.sequence[tail++] = component;
+        }
+      }
+    }
+    return result;
+  }();
+
+private:
+  static_assert(
+      []() {
+        for (std::size_t i = 0; i < size; i++) {
+          if (size == resolved.level[i]) {
+            return false;
+          }
+        }
+        return true;
+      }(),
+      "Dependency cycle is found in the graph!");
+
+  template <std::size_t level>
+  using level_list = type_list_cat_t<std::conditional_t<(level == resolved.level[index_of<Components>]), type_list<Components>, type_list<>>...>;
+
+  template <std::size_t... L> static type_list<level_list<L>...> make_levels(std::index_sequence<L...>);
+  template <typename... Levels> static type_list_cat_t<Levels...> flatten(type_list<Levels...>);
+
+public:
+  // Number of components
+  static constexpr std::size_t SIZE = size;
+  // Index of the component in the graph
+  template <typename Component> static constexpr std::size_t index_v = index_of<Component>;
+  // Level of the component
+  template <typename Component> static constexpr std::size_t level_of = resolved.level[index_of<Component>];
+
+  // Number of levels
+  static constexpr std::size_t LEVELS = []() {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; i++) {
+      count = (resolved.level[i] + 1U > count) ? resolved.level[i] + 1U : count;
+    }
+    return count;
+  }();
+
+  // Type list of levels, every level is a type list of independent components
+  using levels_list = decltype(make_levels(std::make_index_sequence<LEVELS>{}));
+  // All components in the dependency order
+  using order = decltype(flatten(levels_list{}));
+
+  /**
+   * @brief Call 'function(type_list<components of the level>{})' for every level in the dependency order
+   *
+   * @param function Generic function, can start the components of the level concurrently and should wait for them before return
+   */
+  template <typename Function> inline static constexpr void for_each_level(Function &&function) {
+    levels_list::for_each([&function](const auto level) { function(typename decltype(level)::type{}); });
+  }
+
+  // Initialize all components ('Component::init()') sequentially in the dependency order
+  inline static void initialize() {
+    for_each_level([](const auto level) { level.for_each([](const auto component) { decltype(component)::type::init(); }); });
+  }
+};
+
+#ifdef ISO_META_TYPE_HOST
+class work_stealing_pool;
+#endif
+
+/**
+ * @brief Static task graph: tasks and their dependencies are resolved at compile time by 'dependency_graph'
+ *
+ * @note  Usage guideline: task_graph<'tasks...'>::run() or task_graph<'tasks...'>::run('work_stealing_pool')
+ *        Every task is a type with 'static void run()' and optional 'using dependencies = type_list<...>'.
+ *        Topological order, dependency counts and successor lists are constant tables, so the execution
+ *        does not allocate anything per task
+ *
+ * @tparam Tasks Unique task types
+ */
+template <typename... Tasks> class task_graph : public dependency_graph<Tasks...> {
+  using graph = dependency_graph<Tasks...>;
+
+public:
+  // Runners of the tasks in the order of the parameter pack
+  static constexpr void (*const runners[])() = {&Tasks::run...};
+
+  // Run all tasks sequentially in the topological order
+  inline static void run() {
+    for (const auto task : graph::resolved.sequence) {
+      runners[task]();
+    }
+  }
+
+#ifdef ISO_META_TYPE_HOST
+  // Run the tasks on the pool, the calling thread participates and returns when all tasks are done
+  // (the first exception of the tasks is rethrown after the pool is idle)
+  inline static void run(work_stealing_pool &pool);
+#endif
+};
+
+#ifdef ISO_META_TYPE_HOST
+/**
+ * @brief Work-stealing thread pool for 'task_graph' (host builds only, enabled with ISO_META_TYPE_HOST)
+ *
+ * @note  Threads and queues are created once with the pool. Every worker owns a queue of task indexes:
+ *        the owner takes the last pushed task, idle workers steal the oldest one from the others.
+ *        Ready successors are pushed to the queue of the worker that completed the last dependency.
+ *        Exception of a task stops the run: successors of the failed task and the tasks not started yet are skipped,
+ *        'run' rethrows the first exception after all workers are idle (the pool can be used again)
+ */
+class work_stealing_pool {
+public:
+  // Constant description of the graph that is executed
+  struct job {
+    void (*const *runners)();
+    const std::size_t *dependencies;
+    const std::size_t *first;
+    const std::size_t *successors;
+    std::size_t size;
+  };
+
+  /**
+   * @brief Create the pool
+   *
+   * @param workers Number of workers including the thread that calls 'run'
+   */
+  explicit work_stealing_pool(const std::size_t workers = std::thread::hardware_concurrency())
+      : m_Queues(workers ? workers : 1U), m_Stop(false), m_Generation(0), m_Finished(0), m_Job(nullptr) {
+    for (std::size_t worker = 1; worker < m_Queues.size(); worker++) {
+      m_Threads.emplace_back([this, worker]() { serve(worker); });
+    }
+  }
+
+  work_stealing_pool(const work_stealing_pool &) = delete;
+  work_stealing_pool &operator=(const work_stealing_pool &) = delete;
+
+  ~work_stealing_pool() {
+    {
+      const std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Stop = true;
+    }
+    m_Start.notify_all();
+    for (auto &thread : m_Threads) {
+      thread.join();
+    }
+  }
+
+  std::size_t size() const { return m_Queues.size(); }
+
+  /**
+   * @brief Execute the graph, the calling thread is the worker 0
+   *
+   * @param graph     Graph description
+   * @param remaining Storage of the dependency counters (one per task, provided by the caller)
+   */
+  void run(const job &graph, std::atomic<std::size_t> *const remaining) {
+    m_Remaining = remaining;
+    m_Completed.store(0, std::memory_order_relaxed);
+    m_Failed.store(false, std::memory_order_relaxed);
+    m_Error = nullptr;
+    std::size_t root = 0;
+    for (auto &tasks : m_Queues) {
+      tasks.reset(graph.size);
+    }
+    for (std::size_t task = 0; task < graph.size; task++) {
+      remaining[task].store(graph.dependencies[task], std::memory_order_relaxed);
+      if (!graph.dependencies[task]) {
+        m_Queues[root++ % m_Queues.size()].push(task);
+      }
+    }
+    {
+      const std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Job = &graph;
+      m_Finished = 0;
+      m_Generation++;
+    }
+    m_Start.notify_all();
+    execute(0, graph);
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Done.wait(lock, [this]() { return m_Finished + 1U == m_Queues.size(); });
+    m_Job = nullptr;
+    if (m_Error) {
+      const std::exception_ptr error = m_Error;
+      m_Error = nullptr;
+      lock.unlock();
+      std::rethrow_exception(error);
+    }
+  }
+
+private:
+  // Queue of task indexes, every task is pushed once per run, so the storage is reserved once and never wraps
+  class queue {
+    std::mutex m_Mutex;
+    std::vector<std::size_t> m_Tasks;
+    std::size_t m_Head = 0;
+    std::size_t m_Tail = 0;
+
+  public:
+    void reset(const std::size_t capacity) {
+      if (m_Tasks.size() < capacity) {
+        m_Tasks.resize(capacity);
+      }
+      m_Head = m_Tail = 0;
+    }
+    void push(const std::size_t task) {
+      const std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Tasks[m_Tail++] = task;
+    }
+    bool pop(std::size_t &task) {
+      const std::lock_guard<std::mutex> lock(m_Mutex);
+      if (m_Head == m_Tail) {
+        return false;
+      }
+      task = m_Tasks[--m_Tail];
+      return true;
+    }
+    bool steal(std::size_t &task) {
+      const std::lock_guard<std::mutex> lock(m_Mutex);
+      if (m_Head == m_Tail) {
+        return false;
+      }
+      task = m_Tasks[m_Head++];
+      return true;
+    }
+  };
+
+  void execute(const std::size_t worker, const job &graph) {
+    std::size_t task = 0;
+    while ((m_Completed.load(std::memory_order_acquire) < graph.size) && !m_Failed.load(std::memory_order_acquire)) {
+      bool found = m_Queues[worker].pop(task);
+      for (std::size_t victim = 1; !found && (victim < m_Queues.size()); victim++) {
+        found = m_Queues[(worker + victim) % m_Queues.size()].steal(task);
+      }
+      if (!found) {
+        std::this_thread::yield();
+        continue;
+      }
+      try {
+        graph.runners[task]();
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_Error) {
+          m_Error = std::current_exception();
+        }
+        m_Failed.store(true, std::memory_order_release);
+        return;
+      }
+      for (std::size_t edge = graph.first[task]; edge < graph.first[task + 1U]; edge++) {
+        if (1U == m_Remaining[graph.successors[edge]].fetch_sub(1U, std::memory_order_acq_rel)) {
+          m_Queues[worker].push(graph.successors[edge]);
+        }
+      }
+      m_Completed.fetch_add(1U, std::memory_order_acq_rel);
+    }
+  }
+
+  void serve(const std::size_t worker) {
+    std::size_t generation = 0;
+    while (true) {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      m_Start.wait(lock, [this, generation]() { return m_Stop || (m_Generation != generation); });
+      if (m_Stop) {
+        return;
+      }
+      generation = m_Generation;
+      const job &graph = *m_Job;
+      lock.unlock();
+      execute(worker, graph);
+      lock.lock();
+      m_Finished++;
+      lock.unlock();
+      m_Done.notify_one();
+    }
+  }
+
+  std::vector<queue> m_Queues;
+  std::vector<std::thread> m_Threads;
+  std::mutex m_Mutex;
+  std::condition_variable m_Start;
+  std::condition_variable m_Done;
+  bool m_Stop;
+  std::size_t m_Generation;
+  std::size_t m_Finished;
+  const job *m_Job;
+  std::atomic<std::size_t> *m_Remaining = nullptr;
+  std::atomic<std::size_t> m_Completed{0};
+  std::atomic<bool> m_Failed{false};
+  std::exception_ptr m_Error;
+};
+
+template <typename... Tasks> inline void task_graph<Tasks...>::run(work_stealing_pool &pool) {
+  static constexpr work_stealing_pool::job description = {runners, graph::resolved.dependencies, graph::resolved.first, graph::resolved.successors,
+                                                          graph::SIZE};
+  std::atomic<std::size_t> remaining[graph::SIZE];
+  pool.run(description, remaining);
+}
+#endif
+
+/**
+ * @brief Static dependency injection container: all services live in one static storage block at fixed offsets
+ *
+ * @note  Usage guideline: service_container<'services...'>::construct(), then service_container<'services...'>::get<'service'>()
+ *        Every service declares its constructor dependencies as 'using dependencies = type_list<...>' (checked by 'dependency_graph')
+ *        and is constructed from the references to them: 'Service(Dependency &...)'.
+ *        Services are constructed in the dependency order and destroyed in the reverse one, 'get' is a fixed address
+ *
+ * @tparam Services Unique service types
+ */
+template <typename... Services> class service_container : public dependency_graph<Services...> {
+  using graph = dependency_graph<Services...>;
+
+  static constexpr std::size_t sizes[] = {sizeof(Services)...};
+  static constexpr std::size_t alignments[] = {alignof(Services)...};
+
+  struct layout {
+    std::size_t offset[sizeof...(Services)];
+    std::size_t size;
+  };
+  static constexpr layout placement = []() {
+    layout result{};
+    for (std::size_t i = 0; i < sizeof...(Services); i++) {
+      result.offset[i] = (result.size + alignments[i] - 1U) / alignments[i] * alignments[i];
+      result.size = result.offset[i] + sizes[i];
+    }
+    return result;
+  }();
+
+  alignas(Services...) inline static std::byte m_Storage[placement.size];
+
+  template <typename Service, typename... Dependencies> inline static void create(const type_list<Dependencies...>) {
+    ::new (static_cast<void *>(m_Storage + offset_v<Service>)) Service(get<Dependencies>()...);
+  }
+
+public:
+  // Size of the storage block
+  static constexpr std::size_t SIZE = placement.size;
+  // Offset of the service inside the storage block
+  template <typename Service> static constexpr std::size_t offset_v = placement.offset[graph::template index_v<Service>];
+
+  // Construct all services in the dependency order
+  inline static void construct() {
+    graph::for_each_level([](const auto level) {
+      level.for_each([](const auto service) {
+        using Service = typename decltype(service)::type;
+        create<Service>(typename graph::template dependencies_of<Service>::type{});
+      });
+    });
+  }
+
+  // Destroy all services in the reverse dependency order
+  inline static void destroy() {
+    constexpr void (*destructors[])() = {[]() { get<Services>().~Services(); }...};
+    for (std::size_t i = sizeof...(Services); i-- > 0;) {
+      destructors[graph::resolved.sequence[i]]();
+    }
+  }
+
+  /**
+   * @brief Access to the service (valid between 'construct' and 'destroy')
+   *
+   * @tparam Service Type of the service
+   */
+  template <typename Service> inline static Service &get() {
+    static_assert(var_pack::is_type_list<Services...>::template contains_v<Service>, "Service is not in the container!");
+    return *std::launder(reinterpret_cast<Service *>(m_Storage + offset_v<Service>));
+  }
+};
+
+// Number of elements after the offset (no elements if the offset is out of the range)
+inline constexpr std::size_t view_remainder(const std::size_t size, const std::size_t offset) { return (offset <= size) ? size - offset : 0U; }
+
+/**
+ * @brief View with static extent over the array with static storage: source, offset and length are compile-time values
+ *
+ * @note  Usage guideline: static_view<'array', '[auxilary] offset', '[auxilary] length'> or view(const_ref_v<'array'>)
+ *        The view is an empty type (no pointer and length are stored), slicing is resolved at compile time and
+ *        out of range is a compilation error. Copies and reductions have known trip counts, so the compiler unrolls/vectorizes them
+ *
+ * @tparam array  Array with static storage duration
+ * @tparam offset Offset of the first element
+ * @tparam length Number of elements
+ */
+template <const auto &array, const std::size_t offset = 0,
+          const std::size_t length = view_remainder(std::extent_v<std::remove_cv_t<std::remove_reference_t<decltype(array)>>>, offset)>
+class static_view {
+  using Array = std::remove_cv_t<std::remove_reference_t<decltype(array)>>;
+  static_assert(std::is_array_v<Array> && (1U == std::rank_v<Array>), "View supports only one-dimension arrays!");
+  static_assert((offset <= std::extent_v<Array>) && (length <= std::extent_v<Array> - offset), "View is out of the array!");
+
+public:
+  using element_type = std::remove_extent_t<std::remove_reference_t<decltype(array)>>;
+  using value_type = std::remove_cv_t<element_type>;
+
+  static constexpr std::size_t OFFSET = offset;
+  static constexpr std::size_t SIZE = length;
+
+  // Sub-view relative to this view, out of this view is a substitution failure (can be detected with SFINAE)
+  template <const std::size_t subOffset, const std::size_t subLength = view_remainder(length, subOffset)>
+  using subview = std::enable_if_t<(subOffset <= length) && (subLength <= length - subOffset), static_view<array, offset + subOffset, subLength>>;
+
+  template <const std::size_t subOffset, const std::size_t subLength = view_remainder(length, subOffset)>
+  constexpr subview<subOffset, subLength> slice() const {
+    return {};
+  }
+  template <const std::size_t count> constexpr subview<0, count> first() const { return {}; }
+  template <const std::size_t count> constexpr subview<view_remainder(length, count), count> last() const { return {}; }
+
+  inline static constexpr element_type *data() { return array + offset; }
+  inline static constexpr std::size_t size() { return length; }
+  constexpr element_type *begin() const { return data(); }
+  constexpr element_type *end() const { return data() + length; }
+  constexpr element_type &operator[](const std::size_t index) const { return data()[index]; }
+
+  // Element access checked at compile time
+  template <const std::size_t index> inline static constexpr element_type &get() {
+    static_assert(index < length, "Index is out of the view!");
+    return array[offset + index];
+  }
+
+  // Copy all elements to 'out' (at least SIZE elements)
+  inline static constexpr void copy_to(value_type *const out) {
+    for (std::size_t i = 0; i < length; i++) {
+      out[i] = array[offset + i];
+    }
+  }
+
+  /**
+   * @brief Fold all elements in order: function(...function(function(initial, e0), e1)..., eN)
+   *
+   * @param initial  Initial value of the accumulator
+   * @param function Binary function
+   */
+  template <typename T, typename Function> inline static constexpr T reduce(T initial, const Function function) {
+    for (std::size_t i = 0; i < length; i++) {
+      initial = function(initial, array[offset + i]);
+    }
+    return initial;
+  }
+
+  // Sum of all elements
+  inline static constexpr value_type sum() {
+    return reduce(value_type{}, [](const value_type a, const value_type b) { return static_cast<value_type>(a + b); });
+  }
+};
+
+// View over the whole array given as 'const_ref_v'
+template <const auto &array> inline constexpr static_view<array> view(const ConstReference<array>) { return {}; }
+
+/**
+ * @brief Handle of the memory-mapped peripheral with compile-time base address
+ *
+ * @note  Usage guideline: peripheral<'registers layout', const_t<'address'>> or peripheral<'registers layout', mut_ref_t<'linker symbol'>>
+ *        The handle is an empty type and every register access uses the constant address (no pointer is stored and loaded).
+ *        The handle is a const value itself ('is_const_v'/'const_value'), 'value' is the base address (or the symbol reference)
+ *
+ * @tparam Registers Layout of the peripheral registers (volatile members)
+ * @tparam Base      'const_t' with the integral address or 'mut_ref_t' to the object placed at the base address
+ */
+template <typename Registers, typename Base> class peripheral {
+  static_assert(is_const_v<Base> || is_writable_ref_v<Base>, "Base should be const_t or mut_ref_t!");
+
+public:
+  using type = typename Base::type;
+  static constexpr auto &value = Base::value;
+  struct ConstValueT {
+    using type = void;
+  };
+
+  // Pointer to the registers at the base address
+  inline static Registers *registers() {
+    if constexpr (std::is_integral_v<std::remove_cv_t<std::remove_reference_t<type>>>) {
+      return reinterpret_cast<Registers *>(static_cast<std::uintptr_t>(value));
+    } else {
+      return reinterpret_cast<Registers *>(&value);
+    }
+  }
+
+  Registers *operator->() const { return registers(); }
+  Registers &operator*() const { return *registers(); }
+};
+
+// Scatter-gather DMA descriptor (linked list element)
+struct dma_descriptor {
+  const volatile void *source;
+  volatile void *destination;
+  std::uint32_t length;
+  std::uint32_t control;
+  const dma_descriptor *next;
+};
+
+/**
+ * @brief Segment of the DMA transfer
+ *
+ * @note  Usage guideline: dma_segment<const_ref_t<'source'>, mut_ref_t<'destination'>, const_t<'length in bytes'>, '[auxilary] control'>
+ *        or segment(const_ref_v<'source'>, mut_ref_v<'destination'>, const_v<'length in bytes'>)
+ *
+ * @tparam Source      Source object as const_ref_t or mut_ref_t
+ * @tparam Destination Destination object as mut_ref_t (constants are never written by the DMA)
+ * @tparam Length      Length in bytes as const_t
+ * @tparam control     Channel specific control bits of the descriptor
+ */
+template <typename Source, typename Destination, typename Length, const std::uint32_t control = 0> struct dma_segment {
+  static_assert(is_const_ref_v<Source> || is_writable_ref_v<Source>, "Source should be const_ref_t or mut_ref_t!");
+  static_assert(is_writable_ref_v<Destination>, "Destination should be mut_ref_t!");
+  static_assert(is_const_v<Length> && std::is_integral_v<typename Length::type>, "Length should be integral const_t!");
+  static_assert((Length::value > 0) && (static_cast<std::size_t>(Length::value) <= sizeof(Source::value)) &&
+                    (static_cast<std::size_t>(Length::value) <= sizeof(Destination::value)),
+                "Segment length should fit the source and the destination!");
+
+  using source_type = std::remove_reference_t<typename Source::type>;
+  using destination_type = std::remove_reference_t<typename Destination::type>;
+
+  static constexpr std::size_t LENGTH = static_cast<std::size_t>(Length::value);
+  static constexpr std::size_t ALIGNMENT = (alignof(source_type) < alignof(destination_type)) ? alignof(source_type) : alignof(destination_type);
+
+  inline static constexpr dma_descriptor descriptor(const dma_descriptor *const next) {
+    return {&Source::value, &Destination::value, static_cast<std::uint32_t>(LENGTH), control, next};
+  }
+};
+
+template <typename Source, auto &destination, const auto length>
+inline constexpr dma_segment<Source, mut_ref_t<destination>, const_t<length>> segment(const Source, const MutableReference<destination>,
+                                                                                     const ConstValue<length>) {
+  return {};
+}
+
+/**
+ * @brief Linked DMA descriptor chain built at compile time (constant data, nothing is assembled in RAM before the transfer)
+ *
+ * @note  Usage guideline: dma_chain<'alignment', 'segments...'>::value - array of linked descriptors, the first one starts the transfer
+ *        Number of segments, lengths and alignment are validated at compile time (alignment of the object is the alignment of its type,
+ *        so byte buffers should be declared with wider element types or inside aligned structures)
+ *
+ * @tparam alignment Required alignment (in bytes) of the source/destination objects and lengths
+ * @tparam Segments  Segments of the transfer in order
+ */
+template <const std::size_t alignment, typename... Segments> class dma_chain {
+  static_assert(sizeof...(Segments), "DMA chain should have at least one segment!");
+  static_assert(alignment && !(alignment & (alignment - 1U)), "Alignment should be a power of two!");
+  static_assert(((Segments::ALIGNMENT >= alignment) && ...), "Source or destination is not aligned enough for the DMA!");
+  static_assert(((0U == Segments::LENGTH % alignment) && ...), "Segment length should be a multiple of the alignment!");
+
+  template <typename Sequence> struct chain;
+  template <std::size_t... I> struct chain<std::index_sequence<I...>> {
+    static constexpr dma_descriptor value[sizeof...(I)] = {Segments::descriptor((I + 1U < sizeof...(I)) ? &chain::value[I + 1U] : nullptr)...};
+  };
+
+public:
+  static constexpr std::size_t SIZE = sizeof...(Segments);
+  // Total number of bytes transferred by the chain
+  static constexpr std::size_t LENGTH = (Segments::LENGTH + ...);
+  // Descriptors of the chain
+  static constexpr auto &value = chain<std::make_index_sequence<SIZE>>::value;
+};
+
+template <const std::size_t alignment = 1U, typename... Segments> inline constexpr auto dma_chain_v = const_ref_v<dma_chain<alignment, Segments...>::value>;
+
+/**
+ * @brief Compile-time parser of a small key=value configuration (INI subset)
+ *
+ * @note  Usage guideline: config<'text'>::get<'type'>("key") or config<'text'>::get<'type'>("section.key", 'default')
+ *        Format: one entry per line 'key = value', optional sections '[section]', comments start with '#' or ';'.
+ *        Keys are identifiers [A-Za-z0-9_], unique inside the section. Values are decimal, hexadecimal (0x), binary (0b) integers,
+ *        'true'/'false' or any text (as string_view). Malformed text is a compilation error (static_assert),
+ *        missed key or wrong value (also out of the range of the type) is a compilation error when the result is used in a constant
+ *        expression, valid<'type'>("key") checks the same without the error
+ *
+ * @tparam text Character array with static storage (string literal), e.g. static constexpr char board[] = "...";
+ */
+template <const auto &text> class config {
+  using Text = std::remove_cv_t<std::remove_reference_t<decltype(text)>>;
+  static_assert(std::is_array_v<Text> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<Text>>, char>, "Configuration should be a char array!");
+
+  static constexpr std::string_view source{text, std::extent_v<Text> - (('\0' == text[std::extent_v<Text> - 1U]) ? 1U : 0U)};
+
+  struct entry {
+    std::string_view section;
+    std::string_view key;
+    std::string_view value;
+  };
+
+  inline static constexpr bool is_space(const char c) { return (' ' == c) || ('\t' == c) || ('\r' == c); }
+  inline static constexpr bool is_identifier(const std::string_view name) {
+    for (const char c : name) {
+      if (!(((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || ('_' == c))) {
+        return false;
+      }
+    }
+    return !name.empty();
+  }
+  inline static constexpr std::string_view trim(std::string_view line) {
+    while (!line.empty() && is_space(line.front())) {
+      line.remove_prefix(1U);
+    }
+    while (!line.empty() && is_space(line.back())) {
+      line.remove_suffix(1U);
+    }
+    return line;
+  }
+
+  // FNV-1a hash of the section and the key
+  inline static constexpr std::size_t hash(const std::string_view section, const std::string_view key) {
+    std::uint32_t result = 2166136261U;
+    for (const char c : section) {
+      result = (result ^ static_cast<unsigned char>(c)) * 16777619U;
+    }
+    result = (result ^ static_cast<unsigned char>('.')) * 16777619U;
+    for (const char c : key) {
+      result = (result ^ static_cast<unsigned char>(c)) * 16777619U;
+    }
+    return result;
+  }
+
+  // Parse the text, 'entries' can be nullptr to count the entries only. Returns the number of entries or 'source.size() + 1' for an error
+  inline static constexpr std::size_t parse(entry *const entries) {
+    constexpr std::size_t error = source.size() + 1U;
+    std::size_t count = 0;
+    std::string_view section;
+    std::string_view rest = source;
+    while (!rest.empty()) {
+      const std::size_t end = rest.find('\n');
+      const std::string_view line = trim(rest.substr(0, end));
+      rest = (std::string_view::npos == end) ? std::string_view{} : rest.substr(end + 1U);
+
+      if (line.empty() || ('#' == line.front()) || (';' == line.front())) {
+        continue;
+      }
+      if ('[' == line.front()) {
+        if ((']' != line.back()) || !is_identifier(trim(line.substr(1U, line.size() - 2U)))) {
+          return error;
+        }
+        section = trim(line.substr(1U, line.size() - 2U));
+        continue;
+      }
+      const std::size_t equal = line.find('=');
+      if (std::string_view::npos == equal) {
+        return error;
+      }
+      const entry current = {section, trim(line.substr(0, equal)), trim(line.substr(equal + 1U))};
+      if (!is_identifier(current.key) || current.value.empty()) {
+        return error;
+      }
+      if (entries) {
+        entries[count] = current;
+      }
+      count++;
+    }
+    return count;
+  }
+
+  static constexpr std::size_t size = parse(nullptr);
+  static_assert(size <= source.size(), "Configuration text is malformed!");
+
+  // Open addressing hash table of the entries (slot keeps 'index + 1'), so duplicates check and lookup are linear
+  static constexpr std::size_t slots = []() {
+    std::size_t result = 1U;
+    while (result < 2U * size) {
+      result <<= 1U;
+    }
+    return result;
+  }();
+
+  struct table {
+    entry entries[size ? size : 1U];
+    std::size_t slot[slots];
+    bool unique;
+  };
+  static constexpr table parsed = []() {
+    table result{};
+    parse(result.entries);
+    result.unique = true;
+    for (std::size_t i = 0; i < size; i++) {
+      std::size_t slot = hash(result.entries[i].section, result.entries[i].key) & (slots - 1U);
+      while (result.slot[slot]) {
+        const entry &other = result.entries[result.slot[slot] - 1U];
+        result.unique = result.unique && !((other.section == result.entries[i].section) && (other.key == result.entries[i].key));
+        slot = (slot + 1U) & (slots - 1U);
+      }
+      result.slot[slot] = i + 1U;
+    }
+    return result;
+  }();
+  static_assert(parsed.unique, "Configuration keys should be unique inside the section!");
+
+  inline static std::string_view config_error_key_not_found_or_value_is_wrong() { return {}; }
+
+  inline static constexpr const entry *find(const std::string_view name) {
+    const std::size_t dot = name.find('.');
+    const std::string_view section = (std::string_view::npos == dot) ? std::string_view{} : name.substr(0, dot);
+    const std::string_view key = (std::string_view::npos == dot) ? name : name.substr(dot + 1U);
+    for (std::size_t slot = hash(section, key) & (slots - 1U); parsed.slot[slot]; slot = (slot + 1U) & (slots - 1U)) {
+      const entry &candidate = parsed.entries[parsed.slot[slot] - 1U];
+      if ((candidate.section == section) && (candidate.key == key)) {
+        return &candidate;
+      }
+    }
+    return nullptr;
+  }
+
+  // Value of the text converted to 'T': false for a malformed value or a value out of the range of 'T' (without the diagnostic)
+  template <typename T> inline static constexpr bool read(const std::string_view value, T &result) {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+      result = value;
+      return true;
+    } else if constexpr (std::is_same_v<T, bool>) {
+      result = "true" == value;
+      return ("true" == value) || ("false" == value);
+    } else {
+      static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Only integral, enumeration, bool and string_view values are supported!");
+      using Integral = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type;
+      const bool negative = !value.empty() && ('-' == value.front());
+      if (negative && std::is_unsigned_v<Integral>) {
+        return false;
+      }
+      // Magnitude limit: the negative range of the signed type is one more than the positive one
+      constexpr unsigned long long max = std::is_signed_v<Integral> ? ((1ULL << (sizeof(Integral) * 8U - 1U)) - 1U)
+                                                                    : static_cast<unsigned long long>(static_cast<Integral>(~Integral{0}));
+      const unsigned long long limit = negative ? (max + 1U) : max;
+      std::string_view digits = negative ? value.substr(1U) : value;
+      unsigned base = 10U;
+      if ((digits.size() > 2U) && ('0' == digits[0]) && (('x' == digits[1]) || ('X' == digits[1]) || ('b' == digits[1]) || ('B' == digits[1]))) {
+        base = (('x' == digits[1]) || ('X' == digits[1])) ? 16U : 2U;
+        digits.remove_prefix(2U);
+      }
+      if (digits.empty()) {
+        return false;
+      }
+      unsigned long long magnitude = 0;
+      for (const char c : digits) {
+        const unsigned digit = ((c >= '0') && (c <= '9')) ? static_cast<unsigned>(c - '0')
+                               : ((c >= 'a') && (c <= 'f')) ? static_cast<unsigned>(c - 'a' + 10)
+                               : ((c >= 'A') && (c <= 'F')) ? static_cast<unsigned>(c - 'A' + 10)
+                                                            : base;
+        if ((digit >= base) || (magnitude > (limit - digit) / base)) {
+          return false;
+        }
+        magnitude = magnitude * base + digit;
+      }
+      // Negation in the type of the value: the lowest value of the signed type is '-(max) - 1'
+      result = static_cast<T>((negative && magnitude) ? static_cast<Integral>(-static_cast<Integral>(magnitude - 1U) - 1)
+                                                      : static_cast<Integral>(magnitude));
+      return true;
+    }
+  }
+
+  template <typename T> inline static constexpr T convert(const std::string_view value) {
+    T result{};
+    if (!read(value, result)) {
+      config_error_key_not_found_or_value_is_wrong();
+    }
+    return result;
+  }
+
+public:
+  // Number of entries
+  static constexpr std::size_t SIZE = size;
+
+  // Check the key ("key" or "section.key") is present
+  inline static constexpr bool contains(const std::string_view name) { return nullptr != find(name); }
+
+  // Check the key is present and its value is convertible to 'T' (in the format and in the range of the type)
+  template <typename T> inline static constexpr bool valid(const std::string_view name) {
+    const entry *const found = find(name);
+    T result{};
+    return found && read(found->value, result);
+  }
+
+  /**
+   * @brief Value of the key converted to 'T'
+   *
+   * @param name Key as "key" or "section.key"
+   */
+  template <typename T> inline static constexpr T get(const std::string_view name) {
+    const entry *const found = find(name);
+    return found ? convert<T>(found->value) : convert<T>(config_error_key_not_found_or_value_is_wrong());
+  }
+
+  /**
+   * @brief Value of the key converted to 'T' or the default value if the key is missed (the same as var_pack::type<T>::get)
+   *
+   * @param name         Key as "key" or "section.key"
+   * @param defaultValue Value for the missed key
+   */
+  template <typename T> inline static constexpr T get(const std::string_view name, const T defaultValue) {
+    const entry *const found = find(name);
+    return found ? convert<T>(found->value) : defaultValue;
+  }
+};
+
+/**
+ * @brief Regular expression compiled to a DFA transition table at compile time
+ *
+ * @note  Usage guideline: regex<'pattern'>::match(text) for the whole text or regex<'pattern'>::search(text) for any substring.
+ *        Supported subset: literals, '.', escapes (\d \w \s \D \W \S \n \r \t and escaped metacharacters),
+ *        character classes '[a-z_]' / '[^0-9]', groups '( )', alternation '|' and quantifiers '*', '+', '?'.
+ *        Malformed pattern or too big DFA is a compilation error (static_assert).
+ *        Bytes are grouped into equivalence classes, so the table is 'states x classes' and lives in the read-only memory,
+ *        matching is a single table lookup per byte with early exit from the terminal state
+ *
+ * @tparam pattern Character array with static storage (string literal), e.g. static constexpr char word[] = "[a-z]+";
+ */
+template <const auto &pattern> class regex {
+  using Text = std::remove_cv_t<std::remove_reference_t<decltype(pattern)>>;
+  static_assert(std::is_array_v<Text> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<Text>>, char>, "Pattern should be a char array!");
+
+  static constexpr std::string_view source{pattern, std::extent_v<Text> - (('\0' == pattern[std::extent_v<Text> - 1U]) ? 1U : 0U)};
+
+  // Set of bytes
+  struct chars {
+    std::uint64_t bits[4];
+
+    inline constexpr void add(const unsigned c) { bits[c >> 6U] |= (std::uint64_t{1} << (c & 63U)); }
+    inline constexpr void add(const unsigned first, const unsigned last) {
+      for (unsigned c = first; c <= last; c++) {
+        add(c);
+      }
+    }
+    inline constexpr void add(const chars &other) {
+      for (std::size_t i = 0; i < 4U; i++) {
+        bits[i] |= other.bits[i];
+      }
+    }
+    inline constexpr void invert() {
+      for (std::size_t i = 0; i < 4U; i++) {
+        bits[i] = ~bits[i];
+      }
+    }
+    inline constexpr bool contains(const unsigned c) const { return bits[c >> 6U] & (std::uint64_t{1} << (c & 63U)); }
+  };
+
+  // Thompson NFA: every symbol, group and operator adds at most 3 states
+  static constexpr std::size_t capacity = 3U * source.size() + 2U;
+  static constexpr std::size_t none = capacity;
+
+  struct state {
+    chars set;       // Bytes to go to 'out' for the symbol state
+    std::size_t out; // Next state
+    std::size_t alt; // Second next state of the split ('none' for the epsilon state)
+    bool split;      // Epsilon/split state
+  };
+
+  struct fragment {
+    std::size_t start;
+    std::size_t end; // State with 'out' left to patch
+  };
+
+  struct nfa {
+    state states[capacity];
+    std::size_t size;
+    std::size_t start;
+    std::size_t accept;
+    std::size_t position;
+    bool error;
+
+    inline constexpr std::size_t add(const chars &set, const bool split, const std::size_t out, const std::size_t alt) {
+      if (size == capacity) {
+        error = true;
+        return 0;
+      }
+      states[size] = {set, out, alt, split};
+      return size++;
+    }
+    inline constexpr std::size_t epsilon() { return add(chars{}, true, none, none); }
+    inline constexpr bool peek(const char c) const { return (position < source.size()) && (c == source[position]); }
+
+    // Escaped symbol: predefined class or the literal
+    inline constexpr chars escape(const char c) {
+      chars result{};
+      switch (c) {
+      case 'd':
+      case 'D':
+        result.add('0', '9');
+        break;
+      case 'w':
+      case 'W':
+        result.add('a', 'z');
+        result.add('A', 'Z');
+        result.add('0', '9');
+        result.add('_');
+        break;
+      case 's':
+      case 'S':
+        result.add(' ');
+        result.add('\t', '\r');
+        break;
+      case 'n':
+        result.add('\n');
+        break;
+      case 'r':
+        result.add('\r');
+        break;
+      case 't':
+        result.add('\t');
+        break;
+      default:
+        result.add(static_cast<unsigned char>(c));
+        break;
+      }
+      if (('D' == c) || ('W' == c) || ('S' == c)) {
+        result.invert();
+      }
+      return result;
+    }
+
+    // '[...]' with 'position' after '['
+    inline constexpr chars bracket() {
+      chars result{};
+      const bool negative = peek('^');
+      position += negative ? 1U : 0U;
+      bool first = true;
+      while ((position < source.size()) && (first || (']' != source[position]))) {
+        first = false;
+        chars current{};
+        unsigned low = static_cast<unsigned char>(source[position++]);
+        if ('\\' == low) {
+          if (position == source.size()) {
+            break;
+          }
+          current = escape(source[position]);
+          low = static_cast<unsigned char>(source[position++]);
+          low = current.contains(low) ? low : 256U; // Predefined class can't be a range bound
+        } else {
+          current.add(low);
+        }
+        if (peek('-') && (position + 1U < source.size()) && (']' != source[position + 1U]) && (low < 256U)) {
+          const unsigned high = static_cast<unsigned char>(source[position + 1U]);
+          error = error || (high < low) || ('\\' == high);
+          current.add(low, high < low ? low : high);
+          position += 2U;
+        }
+        result.add(current);
+      }
+      if (!peek(']')) {
+        error = true;
+        return result;
+      }
+      position++;
+      if (negative) {
+        result.invert();
+      }
+      return result;
+    }
+
+    inline constexpr fragment atom() {
+      const char c = source[position++];
+      chars set{};
+      switch (c) {
+      case '(': {
+        const fragment result = alternation();
+        if (!peek(')')) {
+          error = true;
+        }
+        position++;
+        return result;
+      }
+      case '[':
+        set = bracket();
+        break;
+      case '.':
+        set.invert();
+        set.bits[0] &= ~(std::uint64_t{1} << '\n');
+        break;
+      case '\\':
+        if (position == source.size()) {
+          error = true;
+          return {0, 0};
+        }
+        set = escape(source[position++]);
+        break;
+      case '*':
+      case '+':
+      case '?':
+        error = true; // Quantifier without the operand
+        return {0, 0};
+      default:
+        set.add(static_cast<unsigned char>(c));
+        break;
+      }
+      const std::size_t symbol = add(set, false, none, none);
+      return {symbol, symbol};
+    }
+
+    inline constexpr fragment repetition() {
+      fragment result = atom();
+      while (!error && (peek('*') || peek('+') || peek('?'))) {
+        const char c = source[position++];
+        const std::size_t exit = epsilon();
+        if ('*' == c) {
+          const std::size_t loop = add(chars{}, true, result.start, exit);
+          states[result.end].out = loop;
+          result = {loop, exit};
+        } else if ('+' == c) {
+          const std::size_t loop = add(chars{}, true, result.start, exit);
+          states[result.end].out = loop;
+          result = {result.start, exit};
+        } else {
+          const std::size_t skip = add(chars{}, true, result.start, exit);
+          states[result.end].out = exit;
+          result = {skip, exit};
+        }
+      }
+      return result;
+    }
+
+    inline constexpr fragment sequence() {
+      fragment result{none, none};
+      while (!error && (position < source.size()) && !peek('|') && !peek(')')) {
+        const fragment next = repetition();
+        if (none == result.start) {
+          result = next;
+        } else {
+          states[result.end].out = next.start;
+          result.end = next.end;
+        }
+      }
+      if (none == result.start) {
+        const std::size_t empty = epsilon();
+        result = {empty, empty};
+      }
+      return result;
+    }
+
+    inline constexpr fragment alternation() {
+      fragment result = sequence();
+      while (!error && peek('|')) {
+        position++;
+        const fragment other = sequence();
+        const std::size_t join = epsilon();
+        const std::size_t fork = add(chars{}, true, result.start, other.start);
+        states[result.end].out = join;
+        states[other.end].out = join;
+        result = {fork, join};
+      }
+      return result;
+    }
+  };
+
+  static constexpr nfa automaton = []() {
+    nfa result{};
+    const fragment whole = result.alternation();
+    result.error = result.error || (result.position != source.size()); // Unbalanced ')'
+    result.accept = result.add(chars{}, false, none, none);
+    result.start = whole.start;
+    if (!result.error) {
+      result.states[whole.end].out = result.accept;
+    }
+    return result;
+  }();
+  static_assert(!automaton.error, "Regular expression is malformed!");
+
+  // Bytes equivalence classes: contiguous ranges of bytes between the boundaries of the symbol sets hit the same states
+  struct alphabet {
+    std::uint8_t of[256];
+    std::uint8_t representative[256];
+    std::size_t size;
+  };
+  static constexpr alphabet classes = []() {
+    chars boundary{};
+    boundary.add(0U);
+    for (std::size_t i = 0; i < automaton.size; i++) {
+      const chars &set = automaton.states[i].set;
+      for (std::size_t w = 0; w < 4U; w++) {
+        boundary.bits[w] |= set.bits[w] ^ ((set.bits[w] << 1U) | (w ? (set.bits[w - 1U] >> 63U) : 0U));
+      }
+    }
+    alphabet result{};
+    for (unsigned c = 0; c < 256U; c++) {
+      if (boundary.contains(c)) {
+        result.representative[result.size++] = static_cast<std::uint8_t>(c);
+      }
+      result.of[c] = static_cast<std::uint8_t>(result.size - 1U);
+    }
+    return result;
+  }();
+
+  // Set of the NFA states, only symbol states and the accepting state are kept (the others don't affect transitions)
+  static constexpr std::size_t words = (capacity + 63U) / 64U;
+  struct subset {
+    std::uint64_t bits[words];
+
+    inline constexpr bool contains(const std::size_t i) const { return bits[i / 64U] & (std::uint64_t{1} << (i % 64U)); }
+    inline constexpr void add(const std::size_t i) { bits[i / 64U] |= (std::uint64_t{1} << (i % 64U)); }
+    inline constexpr void add(const subset &other) {
+      for (std::size_t i = 0; i < words; i++) {
+        bits[i] |= other.bits[i];
+      }
+    }
+    inline constexpr bool empty() const {
+      for (std::size_t i = 0; i < words; i++) {
+        if (bits[i]) {
+          return false;
+        }
+      }
+      return true;
+    }
+    inline constexpr std::size_t hash() const {
+      std::uint64_t result = 0;
+      for (std::size_t i = 0; i < words; i++) {
+        result = (result ^ bits[i]) * 0x9E3779B97F4A7C15ULL;
+        result ^= result >> 29U;
+      }
+      return static_cast<std::size_t>(result);
+    }
+    inline constexpr bool operator==(const subset &other) const {
+      for (std::size_t i = 0; i < words; i++) {
+        if (bits[i] != other.bits[i]) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+  // Epsilon closure of every NFA state
+  struct closures {
+    subset of[capacity];
+  };
+  static constexpr closures reach = []() {
+    closures result{};
+    std::size_t stack[capacity]{};
+    for (std::size_t i = 0; i < automaton.size; i++) {
+      subset visited{};
+      std::size_t size = 0;
+      visited.add(i);
+      stack[size++] = i;
+      while (size) {
+        const std::size_t current = stack[--size];
+        const state &node = automaton.states[current];
+        if (!node.split) {
+          result.of[i].add(current);
+          continue;
+        }
+        const std::size_t targets[] = {node.out, node.alt};
+        for (const std::size_t next : targets) {
+          if ((none != next) && !visited.contains(next)) {
+            visited.add(next);
+            stack[size++] = next;
+          }
+        }
+      }
+    }
+    return result;
+  }();
+
+  // Subset construction, state 0 is terminal: dead state for 'match' and accepted (absorbing) state for 'search'
+  template <const bool search> struct dfa {
+    static constexpr std::size_t limit = 1024U;
+    static constexpr std::size_t slots = 2U * limit;
+
+    struct construction {
+      subset sets[limit];
+      std::uint16_t next[limit * classes.size];
+      bool accept[limit];
+      std::uint16_t slot[slots]; // Open addressing hash table of the sets, slot keeps 'index + 1'
+      std::size_t size;
+      std::size_t start;
+      bool overflow;
+
+      inline constexpr std::size_t intern(const subset &states) {
+        if ((search && states.contains(automaton.accept)) || states.empty()) {
+          return 0;
+        }
+        std::size_t position = states.hash() & (slots - 1U);
+        for (; slot[position]; position = (position + 1U) & (slots - 1U)) {
+          if (sets[slot[position] - 1U] == states) {
+            return slot[position] - 1U;
+          }
+        }
+        if (size == limit) {
+          overflow = true;
+          return 0;
+        }
+        sets[size] = states;
+        accept[size] = states.contains(automaton.accept);
+        slot[position] = static_cast<std::uint16_t>(size + 1U);
+        return size++;
+      }
+    };
+
+    struct transitions {
+      subset to[classes.size];
+    };
+
+    // Add the transitions of the symbol states from the set except the skipped ones
+    inline static constexpr void step(transitions &moved, const subset &from, const subset &skip) {
+      for (std::size_t s = 0; s < automaton.size; s++) {
+        if (!from.bits[s / 64U]) {
+          s |= 63U; // Skip the empty word
+          continue;
+        }
+        if (!from.contains(s) || skip.contains(s) || (s == automaton.accept)) {
+          continue;
+        }
+        for (std::size_t k = 0; k < classes.size; k++) {
+          if (automaton.states[s].set.contains(classes.representative[k])) {
+            moved.to[k].add(reach.of[automaton.states[s].out]);
+          }
+        }
+      }
+    }
+
+    static constexpr construction built = []() {
+      construction result{};
+      result.size = 1U;
+      result.accept[0] = search;
+      result.start = result.intern(reach.of[automaton.start]);
+      // Search restarts the pattern at every byte: every set has the start closure, so its transitions are computed once
+      const subset restart = search ? reach.of[automaton.start] : subset{};
+      transitions common{};
+      for (std::size_t k = 0; k < classes.size; k++) {
+        common.to[k] = restart;
+      }
+      step(common, restart, subset{});
+      for (std::size_t i = 1U; (i < result.size) && !result.overflow; i++) {
+        transitions moved = common;
+        step(moved, result.sets[i], restart);
+        for (std::size_t k = 0; k < classes.size; k++) {
+          result.next[i * classes.size + k] = static_cast<std::uint16_t>(result.intern(moved.to[k]));
+        }
+      }
+      return result;
+    }();
+    static_assert(!built.overflow, "Regular expression DFA is too big!");
+
+    static constexpr std::size_t size = built.size;
+    // Transitions keep the row offset 'state * classes' to avoid multiplication in the loop
+    using index = std::conditional_t<(size * classes.size <= 0x100U), std::uint8_t,
+                                     std::conditional_t<(size * classes.size <= 0x10000U), std::uint16_t, std::uint32_t>>;
+
+    struct table {
+      index next[size * classes.size];
+      std::uint8_t byte_class[256];
+      bool accept[size];
+      index start;
+    };
+    static constexpr table value = []() {
+      table result{};
+      for (std::size_t i = 0; i < size * classes.size; i++) {
+        result.next[i] = static_cast<index>(built.next[i] * classes.size);
+      }
+      for (std::size_t c = 0; c < 256U; c++) {
+        result.byte_class[c] = classes.of[c];
+      }
+      for (std::size_t i = 0; i < size; i++) {
+        result.accept[i] = built.accept[i];
+      }
+      result.start = static_cast<index>(built.start * classes.size);
+      return result;
+    }();
+  };
+
+  template <const bool search> inline static constexpr bool run(const std::string_view text) {
+    const auto &table = dfa<search>::value;
+    std::size_t current = table.start;
+    for (const char c : text) {
+      if (!current) {
+        break;
+      }
+      current = table.next[current + table.byte_class[static_cast<unsigned char>(c)]];
+    }
+    return table.accept[current / classes.size];
+  }
+
+public:
+  // Number of bytes equivalence classes (columns of the transition table)
+  static constexpr std::size_t CLASSES = classes.size;
+  // Number of DFA states (rows of the transition table) for match (default) or search, the table is built only when used
+  template <const bool search = false> static constexpr std::size_t STATES = dfa<search>::size;
+
+  // Whole text matches the pattern
+  inline static constexpr bool match(const std::string_view text) { return run<false>(text); }
+  // Any substring of the text matches the pattern
+  inline static constexpr bool search(const std::string_view text) { return run<true>(text); }
+};
+
+/**
+ * @brief Constant table compressed at compile time with the streaming decompressor
+ *
+ * @note  Usage guideline: compressed<'array', '[auxilary] block size'>::at(index), ::decode(block, out) or compressed<...>::reader(index)
+ *        The table is split into blocks of independent data: the first element of the block is a delta from zero,
+ *        deltas are zigzag encoded into variable-length bytes (7 bits per byte) and repeated deltas are run-length encoded.
+ *        Only the compressed image (data and block offsets) is kept in the read-only memory, the source array is used
+ *        at compile time only. Decoding needs no allocation, random access costs at most one block
+ *
+ * @tparam array     Array of integral elements up to 32 bits with static storage duration
+ * @tparam blockSize Number of elements in the block (granularity of the random access)
+ */
+template <const auto &array, const std::size_t blockSize = 256U> class compressed {
+  using Array = std::remove_cv_t<std::remove_reference_t<decltype(array)>>;
+  static_assert(std::is_array_v<Array> && (1U == std::rank_v<Array>), "Compression supports only one-dimension arrays!");
+
+public:
+  using value_type = std::remove_cv_t<std::remove_extent_t<Array>>;
+
+private:
+  static_assert(std::is_integral_v<value_type> && !std::is_same_v<value_type, bool> && (sizeof(value_type) <= sizeof(std::uint32_t)),
+                "Compression supports integral elements up to 32 bits!");
+  static_assert(blockSize > 0U, "Block should have elements!");
+
+  using unsigned_type = std::make_unsigned_t<value_type>;
+  using signed_type = std::make_signed_t<value_type>;
+
+  // Shortest run of the same delta encoded as the run
+  static constexpr std::size_t minimal_run = 3U;
+
+  inline static constexpr unsigned_type delta(const std::size_t index) {
+    return static_cast<unsigned_type>(static_cast<unsigned_type>(array[index]) -
+                                      ((index % blockSize) ? static_cast<unsigned_type>(array[index - 1U]) : unsigned_type{0}));
+  }
+
+  // Write the variable-length number, 'data' can be nullptr to count the bytes only
+  inline static constexpr std::size_t put(std::uint8_t *const data, std::size_t position, std::uint64_t number) {
+    while (number >= 0x80U) {
+      if (data) {
+        data[position] = static_cast<std::uint8_t>(number | 0x80U);
+      }
+      number >>= 7U;
+      position++;
+    }
+    if (data) {
+      data[position] = static_cast<std::uint8_t>(number);
+    }
+    return position + 1U;
+  }
+
+  /**
+   * @brief Encode the array, 'data' and 'offsets' can be nullptr to count the bytes only
+   *
+   * @return Number of the compressed bytes
+   */
+  template <typename Offset> inline static constexpr std::size_t encode(std::uint8_t *const data, Offset *const offsets) {
+    std::size_t position = 0;
+    for (std::size_t index = 0; index < SIZE;) {
+      if (offsets && !(index % blockSize)) {
+        offsets[index / blockSize] = static_cast<Offset>(position);
+      }
+      const unsigned_type current = delta(index);
+      std::size_t run = 1U;
+      while ((index + run < SIZE) && ((index + run) % blockSize) && (delta(index + run) == current)) {
+        run++;
+      }
+      // Zigzag: small negative deltas become small numbers, the lowest bit of the token marks the run
+      const unsigned_type sign = (static_cast<signed_type>(current) < 0) ? static_cast<unsigned_type>(~unsigned_type{0}) : unsigned_type{0};
+      const unsigned_type zigzag = static_cast<unsigned_type>(static_cast<unsigned_type>(current << 1U) ^ sign);
+      const std::uint64_t token = std::uint64_t{zigzag} << 1U;
+      if (run >= minimal_run) {
+        position = put(data, put(data, position, token | 1U), run - minimal_run);
+        index += run;
+      } else {
+        position = put(data, position, token);
+        index++;
+      }
+    }
+    if (offsets) {
+      offsets[BLOCKS] = static_cast<Offset>(position);
+    }
+    return position;
+  }
+
+public:
+  // Number of elements
+  static constexpr std::size_t SIZE = std::extent_v<Array>;
+  // Number of elements in the block
+  static constexpr std::size_t BLOCK_SIZE = blockSize;
+  // Number of blocks
+  static constexpr std::size_t BLOCKS = (SIZE + blockSize - 1U) / blockSize;
+
+private:
+  static constexpr std::size_t bytes = encode<std::size_t>(nullptr, nullptr);
+  using offset_type = std::conditional_t<(bytes <= 0xFFFFU), std::uint16_t, std::uint32_t>;
+
+  struct compressed_image {
+    std::uint8_t data[bytes ? bytes : 1U];
+    offset_type offsets[BLOCKS + 1U];
+  };
+
+public:
+  // Compressed data with the block offsets
+  static constexpr compressed_image image = []() {
+    compressed_image result{};
+    encode(result.data, result.offsets);
+    return result;
+  }();
+  // Size of the compressed image in bytes (data and block offsets)
+  static constexpr std::size_t BYTES = sizeof(image);
+
+private:
+  // Read the variable-length number
+  inline static constexpr std::uint64_t get(std::size_t &position) {
+    std::uint64_t result = 0;
+    for (unsigned shift = 0;; shift += 7U) {
+      const std::uint8_t byte = image.data[position++];
+      result |= std::uint64_t{byte & 0x7FU} << shift;
+      if (!(byte & 0x80U)) {
+        return result;
+      }
+    }
+  }
+
+  // Read the delta and return the number of elements with it
+  inline static constexpr std::size_t token(std::size_t &position, unsigned_type &delta) {
+    const std::uint64_t token = get(position);
+    const unsigned_type zigzag = static_cast<unsigned_type>(token >> 1U);
+    delta = static_cast<unsigned_type>((zigzag >> 1U) ^ ((zigzag & 1U) ? static_cast<unsigned_type>(~unsigned_type{0}) : unsigned_type{0}));
+    return (token & 1U) ? static_cast<std::size_t>(get(position) + minimal_run) : 1U;
+  }
+
+  inline static value_type compressed_error_index_is_out_of_the_table() { return {}; }
+
+public:
+  /**
+   * @brief Streaming decoder: elements in order starting from any index, the state is a few words on the stack
+   */
+  class reader {
+    std::size_t m_Position = 0; // Byte of the compressed data
+    std::size_t m_Left = 0;     // Elements left in the block
+    std::size_t m_Index = 0;    // Index of the next element
+    std::size_t m_Run = 0;      // Elements left with the same delta
+    unsigned_type m_Value = 0;
+    unsigned_type m_Delta = 0;
+
+  public:
+    /**
+     * @brief Start decoding from the element
+     *
+     * @param index First element to read (the rest of its block before is skipped), out of the table starts at the end
+     */
+    constexpr explicit reader(const std::size_t index = 0) : m_Position(image.offsets[(index < SIZE ? index : SIZE) / blockSize]),
+                                                              m_Index((index < SIZE ? index : SIZE) / blockSize * blockSize) {
+      while (m_Index < (index < SIZE ? index : SIZE)) {
+        next();
+      }
+    }
+
+    // Next element (reading after the last one is an error)
+    constexpr value_type next() {
+      if (empty()) {
+        return compressed_error_index_is_out_of_the_table();
+      }
+      if (!m_Left) {
+        m_Left = ((SIZE - m_Index) < blockSize) ? (SIZE - m_Index) : blockSize;
+        m_Value = 0;
+        m_Run = 0;
+      }
+      if (!m_Run) {
+        m_Run = token(m_Position, m_Delta);
+      }
+      m_Run--;
+      m_Left--;
+      m_Index++;
+      m_Value = static_cast<unsigned_type>(m_Value + m_Delta);
+      return static_cast<value_type>(m_Value);
+    }
+
+    // Index of the next element
+    constexpr std::size_t index() const { return m_Index; }
+    // All elements are read
+    constexpr bool empty() const { return SIZE == m_Index; }
+  };
+
+  /**
+   * @brief Decode the whole block
+   *
+   * @param block Index of the block
+   * @param out   Buffer for at least BLOCK_SIZE elements
+   *
+   * @return Number of decoded elements (the last block can be shorter, nothing is decoded for the block out of the table)
+   */
+  inline static constexpr std::size_t decode(const std::size_t block, value_type *const out) {
+    if (block >= BLOCKS) {
+      return 0U;
+    }
+    const std::size_t count = ((SIZE - block * blockSize) < blockSize) ? (SIZE - block * blockSize) : blockSize;
+    std::size_t position = image.offsets[block];
+    unsigned_type value = 0;
+    for (std::size_t index = 0; index < count;) {
+      unsigned_type delta = 0;
+      for (std::size_t run = token(position, delta); run; run--) {
+        value = static_cast<unsigned_type>(value + delta);
+        out[index++] = static_cast<value_type>(value);
+      }
+    }
+    return count;
+  }
+
+  // Decode all elements to 'out' (at least SIZE elements)
+  inline static constexpr void decompress(value_type *const out) {
+    for (std::size_t block = 0; block < BLOCKS; block++) {
+      decode(block, out + block * blockSize);
+    }
+  }
+
+  // Element by index (decodes its block up to the element), index out of the table is an error
+  inline static constexpr value_type at(const std::size_t index) { return reader(index).next(); }
+};
+
+/**
+ * @brief Reflection of the aggregate (struct without constructors, bases and array members) up to 64 fields
+ *
+ * @note  Usage guideline: aggregate<'type'>::SIZE, aggregate<'type'>::types (type_list of the fields),
+ *        aggregate<'type'>::apply('value', 'function') calls 'function(fields...)', aggregate<'type'>::for_each('value', 'function')
+ *        Number of fields is found by the binary search over the aggregate initialization (O(log) checks instead of one per count),
+ *        fields are bound with the structured binding, so the field types can be validated with var_pack traits
+ *        and serializers can be generated without repeating the field list
+ *
+ * @tparam T Aggregate type
+ */
+template <typename T> class aggregate {
+  static_assert(std::is_aggregate_v<T>, "Reflection supports only aggregate types!");
+
+  static constexpr std::size_t limit = 64U;
+
+  // Initializer of any field (the aggregate itself is excluded to not be taken as the copy)
+  template <const std::size_t> struct any_field {
+    template <typename U, typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<U>, T>>> constexpr operator U &() const noexcept;
+  };
+
+  template <typename Indexes, typename = void> struct is_initializable {
+    static constexpr bool value = false;
+  };
+  template <std::size_t... I> struct is_initializable<std::index_sequence<I...>, std::void_t<decltype(T{any_field<I>{}...})>> {
+    static constexpr bool value = true;
+  };
+
+  // Initialization with 'count' values is valid for every count up to the number of fields, so the last valid count is found with bisection
+  template <const std::size_t low, const std::size_t high> inline static constexpr std::size_t count() {
+    if constexpr (low == high) {
+      return low;
+    } else if constexpr (is_initializable<std::make_index_sequence<(low + high + 1U) / 2U>>::value) {
+      return count<(low + high + 1U) / 2U, high>();
+    } else {
+      return count<low, (low + high + 1U) / 2U - 1U>();
+    }
+  }
+
+public:
+  // Number of fields
+  static constexpr std::size_t SIZE = count<0, limit>();
+  static_assert((SIZE < limit) || !is_initializable<std::make_index_sequence<limit + 1U>>::value, "Reflection supports up to 64 fields!");
+
+private:
+  template <typename Value, typename Function> inline static constexpr decltype(auto) bind([[maybe_unused]] Value &value, Function &&function) {
+    if constexpr (0U == SIZE) {
+      return function();
+    } else if constexpr (1U == SIZE) {
+      auto &[f0] = value;
+      return function(f0);
+    } else if constexpr (2U == SIZE) {
+      auto &[f0, f1] = value;
+      return function(f0, f1);
+    } else if constexpr (3U == SIZE) {
+      auto &[f0, f1, f2] = value;
+      return function(f0, f1, f2);
+    } else if constexpr (4U == SIZE) {
+      auto &[f0, f1, f2, f3] = value;
+      return function(f0, f1, f2, f3);
+    } else if constexpr (5U == SIZE) {
+      auto &[f0, f1, f2, f3, f4] = value;
+      return function(f0, f1, f2, f3, f4);
+    } else if constexpr (6U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5] = value;
+      return function(f0, f1, f2, f3, f4, f5);
+    } else if constexpr (7U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6);
+    } else if constexpr (8U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7);
+    } else if constexpr (9U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+    } else if constexpr (10U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+    } else if constexpr (11U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+    } else if constexpr (12U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+    } else if constexpr (13U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+    } else if constexpr (14U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+    } else if constexpr (15U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+    } else if constexpr (16U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+    } else if constexpr (17U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+    } else if constexpr (18U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17);
+    } else if constexpr (19U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18);
+    } else if constexpr (20U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19);
+    } else if constexpr (21U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20);
+    } else if constexpr (22U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21);
+    } else if constexpr (23U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22);
+    } else if constexpr (24U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23);
+    } else if constexpr (25U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24);
+    } else if constexpr (26U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25);
+    } else if constexpr (27U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26);
+    } else if constexpr (28U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27);
+    } else if constexpr (29U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28);
+    } else if constexpr (30U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29);
+    } else if constexpr (31U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30);
+    } else if constexpr (32U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31);
+    } else if constexpr (33U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32);
+    } else if constexpr (34U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33);
+    } else if constexpr (35U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34);
+    } else if constexpr (36U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35);
+    } else if constexpr (37U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36);
+    } else if constexpr (38U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37);
+    } else if constexpr (39U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38);
+    } else if constexpr (40U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39);
+    } else if constexpr (41U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40);
+    } else if constexpr (42U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41);
+    } else if constexpr (43U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42);
+    } else if constexpr (44U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43);
+    } else if constexpr (45U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44);
+    } else if constexpr (46U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45);
+    } else if constexpr (47U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46);
+    } else if constexpr (48U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47);
+    } else if constexpr (49U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48);
+    } else if constexpr (50U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49);
+    } else if constexpr (51U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50);
+    } else if constexpr (52U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51);
+    } else if constexpr (53U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52);
+    } else if constexpr (54U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53);
+    } else if constexpr (55U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54);
+    } else if constexpr (56U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55);
+    } else if constexpr (57U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56);
+    } else if constexpr (58U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57);
+    } else if constexpr (59U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57, f58] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57, f58);
+    } else if constexpr (60U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57, f58, f59] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57, f58, f59);
+    } else if constexpr (61U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57, f58, f59, f60] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57, f58, f59, f60);
+    } else if constexpr (62U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57, f58, f59, f60, f61] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57, f58, f59, f60, f61);
+    } else if constexpr (63U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57, f58, f59, f60, f61, f62] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62);
+    } else if constexpr (64U == SIZE) {
+      auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28,
+             f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55,
+             f56, f57, f58, f59, f60, f61, f62, f63] = value;
+      return function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26,
+                      f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47, f48, f49, f50, f51,
+                      f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63);
+    }
+  }
+
+  struct collect_types {
+    template <typename... Fields> constexpr type_list<std::remove_cv_t<Fields>...> operator()(Fields &...) const { return {}; }
+  };
+
+public:
+  // Types of the fields (cv-unqualified) in the declaration order
+  using types = decltype(bind(std::declval<T &>(), collect_types{}));
+
+  /**
+   * @brief Call the function with references to all fields: function(field0, field1, ...)
+   *
+   * @param value    Aggregate (const or not)
+   * @param function Function with SIZE arguments
+   */
+  template <typename Value, typename Function> inline static constexpr decltype(auto) apply(Value &value, Function &&function) {
+    static_assert(std::is_same_v<std::remove_cv_t<Value>, T>, "Value should be the reflected aggregate!");
+    return bind(value, function);
+  }
+
+  /**
+   * @brief Call the function for every field in the declaration order
+   *
+   * @param value    Aggregate (const or not)
+   * @param function Function with one argument (the reference to the field)
+   */
+  template <typename Value, typename Function> inline static constexpr void for_each(Value &value, Function &&function) {
+    apply(value, [&function](auto &...fields) { (function(fields), ...); });
+  }
+};
+
+// Field of the bundle: the value is found by the type of the base class (no scan of the pack)
+template <typename T> struct bundle_field {
+  T value;
+};
+
+/**
+ * @brief Bundle of the named (type-tagged) arguments indexed once: every field access is O(1) at compile time and one call at runtime
+ *
+ * @note  Usage guideline: bundle<'Args...'> args('values...'); args.get<'type'>() or args.get_or<'type'>('default')
+ *        The bundle inherits one base per argument type, so the lookup is the derived-to-base conversion instead of
+ *        one var_pack::type<T>::get scan of the whole pack per field
+ *
+ * @tparam Args Types of the arguments (unique)
+ */
+template <typename... Args> class bundle : private bundle_field<Args>... {
+  static_assert(var_pack::is_types_unique_v<Args...>, "Bundle arguments should have unique types!");
+
+public:
+  // Number of arguments
+  static constexpr std::size_t SIZE = sizeof...(Args);
+
+  // Argument of the type is in the bundle
+  template <typename T> static constexpr bool contains_v = std::is_base_of_v<bundle_field<T>, bundle>;
+
+  // One value per argument; a bundle as the value is left to the copy and move constructors
+  template <typename... Values, typename = std::enable_if_t<(sizeof...(Values) == SIZE) && !(std::is_same_v<std::decay_t<Values>, bundle> || ...)>>
+  constexpr explicit bundle(Values &&...values) : bundle_field<Args>{std::forward<Values>(values)}... {}
+
+  // Argument of the type, missed argument is a compilation error
+  template <typename T> constexpr const T &get() const {
+    static_assert(contains_v<T>, "No argument of the type in the bundle!");
+    return static_cast<const bundle_field<T> &>(*this).value;
+  }
+  template <typename T> constexpr T &get() {
+    static_assert(contains_v<T>, "No argument of the type in the bundle!");
+    return static_cast<bundle_field<T> &>(*this).value;
+  }
+
+  // Argument of the type or the default value (the same as var_pack::type<T>::get)
+  template <typename T> constexpr T get_or(const T defaultValue) const {
+    if constexpr (contains_v<T>) {
+      return get<T>();
+    } else {
+      return defaultValue;
+    }
+  }
+};
+
+template <typename... Args> bundle(Args...) -> bundle<Args...>;
+
+// Slot of the configuration word: type of the value and its width in bits
+template <typename T, const std::size_t bits> struct config_slot {
+  using type = T;
+  static constexpr std::size_t WIDTH = bits;
+};
+
+/**
+ * @brief Configuration word: validated value pack packed into one unsigned integer to be used as a single template parameter
+ *
+ * @note  Usage guideline: template <const std::uint32_t config> class Gpio {...}; Gpio<config_word<'word', 'slots...'>::pack('values...')>
+ *        and config_word<'word', 'slots...'>::get<'type'>(config) inside. Instantiations carry one short integer instead of
+ *        the whole value pack, so mangled names, object files and debug info stay small. Values are validated with var_pack
+ *        once in pack(), missed values are zero (the default of var_pack::type<T>::get), out of slot value is a compilation error
+ *
+ * @tparam Word  Unsigned integral type of the word
+ * @tparam Slots config_slot<'type', 'bits'> in the order from the least significant bit
+ */
+template <typename Word, typename... Slots> class config_word {
+  static_assert(std::is_integral_v<Word> && std::is_unsigned_v<Word>, "Configuration word should be unsigned integral!");
+  static_assert(sizeof...(Slots) && var_pack::is_types_unique_v<typename Slots::type...>, "Slot types should be unique!");
+  static_assert((Slots::WIDTH + ...) <= 8U * sizeof(Word), "Slots don't fit the configuration word!");
+  static_assert(((Slots::WIDTH > 0U) && ...), "Slot should have bits!");
+
+  static constexpr std::size_t widths[] = {Slots::WIDTH...};
+
+  template <typename T> static constexpr std::size_t index_v = []() {
+    static_assert(var_pack::is_type_list<typename Slots::type...>::template contains_v<T>, "No slot of the type in the configuration word!");
+    const bool found[] = {std::is_same_v<T, typename Slots::type>...};
+    std::size_t index = 0;
+    while (!found[index]) {
+      index++;
+    }
+    return index;
+  }();
+
+  inline static Word config_word_error_value_does_not_fit_the_slot() { return {}; }
+
+  // Range is checked on the value itself before it is narrowed to the word: negative and wider values are rejected
+  template <typename T> inline static constexpr Word encode(const T value) {
+    using Integral = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::common_type<T>>::type;
+    const Integral raw = static_cast<Integral>(value);
+    if constexpr (std::is_signed_v<Integral>) {
+      if (raw < 0) {
+        return config_word_error_value_does_not_fit_the_slot();
+      }
+    }
+    return (static_cast<unsigned long long>(MASK<T>) < static_cast<unsigned long long>(raw)) ? config_word_error_value_does_not_fit_the_slot()
+                                                                                             : static_cast<Word>(static_cast<Word>(raw) << OFFSET<T>);
+  }
+
+public:
+  using word_type = Word;
+
+  // Position of the slot of the type
+  template <typename T> static constexpr std::size_t OFFSET = []() {
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < index_v<T>; i++) {
+      offset += widths[i];
+    }
+    return offset;
+  }();
+  // Width of the slot of the type
+  template <typename T> static constexpr std::size_t WIDTH = widths[index_v<T>];
+  // Mask of the slot value (not shifted)
+  template <typename T> static constexpr Word MASK = static_cast<Word>(static_cast<Word>(~Word{0}) >> (8U * sizeof(Word) - WIDTH<T>));
+
+  /**
+   * @brief Pack the values in any order into the word
+   *
+   * @param values Values of the slot types (unique, every type should have the slot)
+   */
+  template <typename... Values> inline static constexpr Word pack([[maybe_unused]] const Values... values) {
+    static_assert(var_pack::is_types_unique_v<Values...> && var_pack::is_type_list<typename Slots::type...>::template contains_v<Values...>,
+                  "Wrong values of the configuration word!");
+    return static_cast<Word>((Word{0} | ... | encode(values)));
+  }
+
+  // Value of the slot from the word
+  template <typename T> inline static constexpr T get(const Word word) { return static_cast<T>((word >> OFFSET<T>) & MASK<T>); }
+};
+} // namespace iso::meta_type
+
+// Bit manipulation extensions for 'bit_gather' (pext/pdep), only when the target enables them
+#if defined(__BMI2__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace iso::meta_type {
+/**
+ * @brief Bit field descriptor for the multi-field access
+ *
+ * @note  Usage guideline: bit_range<const_t<'offset'>, const_t<'width'>>
+ *
+ * @tparam Offset Position of the lowest bit (integral const_t)
+ * @tparam Width  Number of bits (integral const_t)
+ */
+template <typename Offset, typename Width> struct bit_range {
+  static_assert(is_const_v<Offset> && std::is_integral_v<typename Offset::type>, "Offset should be integral const_t!");
+  static_assert(is_const_v<Width> && std::is_integral_v<typename Width::type>, "Width should be integral const_t!");
+  static_assert(!(Offset::value < 0) && (Width::value > 0), "Field should have bits!");
+
+  static constexpr std::size_t OFFSET = static_cast<std::size_t>(Offset::value);
+  static constexpr std::size_t WIDTH = static_cast<std::size_t>(Width::value);
+};
+
+/**
+ * @brief Several non-contiguous bit fields of the word extracted or inserted at once
+ *
+ * @note  Usage guideline: bit_gather<'word type', bit_range<...>...>::extract('word') or ::insert('word', 'compact')
+ *        Fields are gathered into the compact value in the order of their bits (the lowest field is in the lowest bits),
+ *        position of every field in the compact value is POSITION<'index of the descriptor'>.
+ *        Masks are computed at compile time. With BMI2 ('-mbmi2', '-march=haswell' and newer) the whole gather is one pext
+ *        (the scatter is one pdep), otherwise the fields are merged into the runs of adjacent bits and every run costs a shift
+ *        and a mask. One run is always the shift and the mask (cheaper than pext, which is also slow on AMD before Zen 3).
+ *        Without fields the mask is empty: extract gives zero and insert keeps the word
+ *
+ * @tparam Word   Unsigned integral type up to 64 bits
+ * @tparam Ranges Field descriptors (bit_range, possibly none), fields should not overlap
+ */
+template <typename Word, typename... Ranges> class bit_gather {
+  static_assert(std::is_integral_v<Word> && std::is_unsigned_v<Word> && !std::is_same_v<Word, bool> && (sizeof(Word) <= sizeof(std::uint64_t)),
+                "Word should be unsigned integral up to 64 bits!");
+  static_assert(((Ranges::OFFSET + Ranges::WIDTH <= sizeof(Word) * 8U) && ...), "Field should fit the word!");
+
+  inline static constexpr Word low_mask(const std::size_t width) {
+    return (width >= sizeof(Word) * 8U) ? static_cast<Word>(~Word{0}) : static_cast<Word>((Word{1} << width) - 1U);
+  }
+
+  static constexpr std::array<std::size_t, sizeof...(Ranges)> offsets = {Ranges::OFFSET...};
+  static constexpr std::array<std::size_t, sizeof...(Ranges)> widths = {Ranges::WIDTH...};
+
+public:
+  using word_type = Word;
+
+  // Number of fields
+  static constexpr std::size_t SIZE = sizeof...(Ranges);
+  // Bits of all fields
+  static constexpr Word MASK = static_cast<Word>((Word{0} | ... | static_cast<Word>(low_mask(Ranges::WIDTH) << Ranges::OFFSET)));
+  // Number of bits in the compact value
+  static constexpr std::size_t WIDTH = (std::size_t{0} + ... + Ranges::WIDTH);
+
+  static_assert([]() {
+    std::size_t bits = 0;
+    for (Word mask = MASK; mask; mask &= static_cast<Word>(mask - 1U)) {
+      bits++;
+    }
+    return WIDTH == bits;
+  }(), "Fields should not overlap!");
+
+  // Position of the field (by the index of the descriptor) in the compact value: total width of the fields below it
+  template <const std::size_t index> static constexpr std::size_t POSITION = []() {
+    static_assert(index < SIZE, "Field index is out of the list!");
+    std::size_t position = 0;
+    for (std::size_t i = 0; i < SIZE; i++) {
+      position += (offsets[i] < offsets[index]) ? widths[i] : 0U;
+    }
+    return position;
+  }();
+
+private:
+  // Run of the adjacent bits: the same shift for all its fields
+  struct run {
+    std::size_t source; // Offset in the word
+    std::size_t target; // Offset in the compact value
+    Word mask;          // Mask of the low bits
+  };
+
+  struct run_table {
+    std::size_t size;
+    std::array<run, SIZE> runs;
+  };
+
+  static constexpr run_table table = []() {
+    run_table result{};
+    std::size_t target = 0;
+    for (std::size_t bit = 0; bit < sizeof(Word) * 8U; bit++) {
+      if ((MASK >> bit) & 1U) {
+        std::size_t width = 0;
+        while ((bit + width < sizeof(Word) * 8U) && ((MASK >> (bit + width)) & 1U)) {
+          width++;
+        }
+        result.runs[result.size++] = {bit, target, low_mask(width)};
+        target += width;
+        bit += width;
+      }
+    }
+    return result;
+  }();
+
+public:
+  // Number of the shift and mask steps without BMI2
+  static constexpr std::size_t RUNS = table.size;
+
+private:
+  template <std::size_t... runs> inline static constexpr Word gather([[maybe_unused]] const Word word, std::index_sequence<runs...>) {
+    return static_cast<Word>((Word{0} | ... |
+                              static_cast<Word>(static_cast<Word>((word >> table.runs[runs].source) & table.runs[runs].mask)
+                                                << table.runs[runs].target)));
+  }
+
+  template <std::size_t... runs> inline static constexpr Word scatter([[maybe_unused]] const Word compact, std::index_sequence<runs...>) {
+    return static_cast<Word>((Word{0} | ... |
+                              static_cast<Word>(static_cast<Word>((compact >> table.runs[runs].target) & table.runs[runs].mask)
+                                                << table.runs[runs].source)));
+  }
+
+public:
+  /**
+   * @brief Shift and mask implementation (unrolled over the runs), the reference for the BMI2 one
+   *
+   * @param word Source word
+   *
+   * @return Compact value of the fields
+   */
+  inline static constexpr Word extract_scalar(const Word word) { return gather(word, std::make_index_sequence<RUNS>{}); }
+
+  /**
+   * @brief Shift and mask implementation (unrolled over the runs), the reference for the BMI2 one
+   *
+   * @param word    Destination word (bits out of the fields are kept)
+   * @param compact Compact value of the fields (bits over WIDTH are ignored)
+   *
+   * @return Word with the fields from the compact value
+   */
+  inline static constexpr Word insert_scalar(const Word word, const Word compact) {
+    return static_cast<Word>((word & static_cast<Word>(~MASK)) | scatter(compact, std::make_index_sequence<RUNS>{}));
+  }
+
+  // Compact value of the fields with the cheapest available instructions
+  inline static Word extract(const Word word) {
+#if defined(__BMI2__) && defined(__x86_64__)
+    if constexpr (RUNS > 1U) {
+      if constexpr (sizeof(Word) > sizeof(std::uint32_t)) {
+        return static_cast<Word>(_pext_u64(word, MASK));
+      } else {
+        return static_cast<Word>(_pext_u32(word, MASK));
+      }
+    }
+#endif
+    return extract_scalar(word);
+  }
+
+  // Word with the fields from the compact value with the cheapest available instructions
+  inline static Word insert(const Word word, const Word compact) {
+#if defined(__BMI2__) && defined(__x86_64__)
+    if constexpr (RUNS > 1U) {
+      if constexpr (sizeof(Word) > sizeof(std::uint32_t)) {
+        return static_cast<Word>((word & static_cast<Word>(~MASK)) | _pdep_u64(compact, MASK));
+      } else {
+        return static_cast<Word>((word & static_cast<Word>(~MASK)) | _pdep_u32(compact, MASK));
+      }
+    }
+#endif
+    return insert_scalar(word, compact);
+  }
+
+  // Field (by the index of the descriptor) from the compact value
+  template <const std::size_t index> inline static constexpr Word get(const Word compact) {
+    return static_cast<Word>((compact >> POSITION<index>) & low_mask(widths[index]));
+  }
+};
+
+#ifdef ISO_META_TYPE_UNITTEST
+// Unit test for the module. As it is compile time - can be performed during every compilation
+namespace unit_tests {
+// Test Types
+struct TestType1 {};
+struct TestType2 {};
+struct TestType3 {};
+enum class TestType4 : unsigned { TestValue0 = 0x5667U, TestValue1 = 0xA100U, TestValue2 = 0x7832AD01UL };
+enum class TestType5 : int { TestValue0 = -777, TestValue1 = 256901 };
+enum class TestType6 { TestValue0, TestValue1, TestValue2, TestValue3 };
+using TestType7 = bool;
+using TestType8 = unsigned long;
+using TestType9 = unsigned;
+
+template <typename... Args> inline constexpr bool unique_args(const Args...) { return var_pack::is_types_unique_v<Args...>; }
+template <typename... Args> inline constexpr bool unique_args2(const Args... args) { return var_pack::is_types_val_unique_v(args...); }
+template <typename... Args> inline constexpr bool types456inside(const Args...) {
+  return var_pack::is_type_list<TestType4, TestType5, TestType6>::contains_v<Args...>;
+}
+
+#ifdef __cpp_concepts
+template <typename... Args>
+requires types_unique<Args...> && (var_pack::is_type_list<TestType1, TestType2, TestType3>::contains_v<Args...>)
+inline constexpr bool test_with_requires123(const Args...) {
+  return true;
+}
+#endif
+
+class Test {
+  // Test for no type repetition in the parameter pack
+  static_assert(var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6>, "Check the unique list 1");
+  static_assert(var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6, TestType4, TestType9, TestType7>, "Check the unique list 2");
+  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6, TestType4, TestType3, TestType7>,
+                "Check not unique in the middle 1");
+  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType6, TestType2, TestType8, TestType7>,
+                "Check not unique in the middle 2");
+  static_assert(!var_pack::is_types_unique_v<TestType1, TestType6, TestType4, TestType1, TestType7>, "Check not unique in at the start 1");
+  static_assert(!var_pack::is_types_unique_v<TestType4, TestType6, TestType4, TestType5, TestType7>, "Check not unique in at the start 2");
+  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType6, TestType6>, "Check not unique in at the end 1");
+  static_assert(!var_pack::is_types_unique_v<TestType1, TestType2, TestType3, TestType7, TestType4, TestType9, TestType7>, "Check the unique end 2");
+  static_assert(unique_args(TestType1{}, TestType4::TestValue0, TestType3{}, TestType6::TestValue0), "Check the unique list with function 1");
+  static_assert(!unique_args(TestType1{}, TestType9{}, TestType3{}, TestType6{}, TestType9{}, TestType7{}), "Check the unique list with function2");
+  static_assert(unique_args(), "Check the empty unique list with function");
+#ifdef __cpp_concepts
+  static_assert(types_unique<TestType1, TestType2, TestType3, TestType6>, "Check the unique list with concept 1");
+  static_assert(!types_unique<TestType1, TestType7, TestType3, TestType4, TestType9, TestType7>, "Check the unique list with concept 2");
+#endif
+
+  // Test for no type lists (that there are required types)
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType6>::contains_v<TestType1>, "Check a type at the start of the list");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType9, TestType3, TestType6>::contains_v<TestType9>,
+                "Check a type at the middle of the list");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType9, TestType3, TestType6>::contains_v<TestType6>,
+                "Check a type at the end of the list");
+  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType9, TestType3, TestType6>::contains_v<TestType7>, "Check a wrong type");
+
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType1, TestType4,
+                                                                                                                                TestType7, TestType8>,
+                "Check types list of types");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType7,
+                                                                                                                                TestType1, TestType4>,
+                "Check reverse types list of types");
+  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8,
+                                        TestType9>::contains_v<TestType5, TestType4, TestType7, TestType8>,
+                "Check types list of types with no type at start");
+  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8,
+                                        TestType9>::contains_v<TestType1, TestType5, TestType7, TestType8>,
+                "Check types list of types with no type at middle");
+  static_assert(!var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8,
+                                        TestType9>::contains_v<TestType1, TestType4, TestType7, TestType5>,
+                "Check types list of types with no type at end");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType9, TestType7,
+                                                                                                                                TestType1, TestType4>,
+                "Check edges 1");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType9,
+                                                                                                                                TestType1, TestType4>,
+                "Check edges 2");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType3,
+                                                                                                                                TestType1, TestType9>,
+                "Check edges 3");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType1, TestType7,
+                                                                                                                                TestType3, TestType4>,
+                "Check edges 4");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType1,
+                                                                                                                                TestType3, TestType4>,
+                "Check edges 5");
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3, TestType4, TestType7, TestType8, TestType9>::contains_v<TestType8, TestType3,
+                                                                                                                                TestType7, TestType1>,
+                "Check edges 6");
+  static_assert(types456inside(TestType4::TestValue2), "Check with function 1");
+  static_assert(types456inside(TestType5::TestValue0), "Check with function 2");
+  static_assert(types456inside(TestType6::TestValue1), "Check with function 3");
+  static_assert(!types456inside(TestType7{}), "Check with function 4");
+  static_assert(!types456inside(TestType7{}, TestType5::TestValue0, TestType6::TestValue3), "Check with function 5");
+  static_assert(!types456inside(TestType4::TestValue0, TestType7{}, TestType6::TestValue3), "Check with function 6");
+  static_assert(!types456inside(TestType4::TestValue1, TestType5::TestValue0, TestType7{}), "Check with function 7");
+  static_assert(types456inside(TestType4::TestValue1, TestType5::TestValue0, TestType6::TestValue3), "Check with function 8");
+  static_assert(types456inside(), "Check with function 9");
+
+  static_assert(var_pack::is_type_list<TestType1, TestType2, TestType3>::contains_v<TestType1, TestType3>);
+
+#ifdef __cpp_concepts
+  static_assert(test_with_requires123(TestType1{}, TestType3{}), "Test for requires expression 1");
+  static_assert(test_with_requires123(TestType2{}), "Test for requires expression 2");
+  static_assert(test_with_requires123(), "Test for requires expression 3");
+#endif
+
+  static_assert((TestType4::TestValue2 == var_pack::type<TestType4>::get(true, TestType4::TestValue2, 367UL)), "Test for get_by_type expression 1");
+  static_assert((static_cast<TestType4>(0) == var_pack::type<TestType4>::get(true, -1, 367U)), "Test for get_by_type expression 2");
+  static_assert((TestType4::TestValue1 == var_pack::type<TestType4, TestType4::TestValue1>::get(true, -1, 367U)),
+                "Test for get_by_type expression 3");
+
+  static_assert(var_pack::is_types_val_unique_v(TestType4::TestValue2, TestType5::TestValue1, true), "Test for get_by_type expression 1");
+  static_assert(!var_pack::is_types_val_unique_v(TestType4::TestValue2, false, TestType5::TestValue1, true), "Test for get_by_type expression 2");
+  static_assert(var_pack::is_types_val_unique_v(TestType4::TestValue2, TestType5::TestValue1, true, -36, 5743737U, TestType6::TestValue3),
                 "Test for get_by_type expression 3");
 
   static_assert(unique_args2(TestType1{}, TestType4::TestValue0, TestType3{}, TestType6::TestValue0), "Check the unique list with function 1");
@@ -440,6 +3785,1037 @@ class Test {
                 "Check type list with params 2");
   static_assert(var_pack::is_type_val_list<signed, TestType4, bool, unsigned, long>::contains_v(), "Check type list with params 3");
 };
+
+// Byte swap of every 32-bit word (endianness conversion of 4 words)
+static constexpr std::uint8_t byte_swap32_pattern[] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+using ByteSwap32 = shuffle_of<std::uint8_t, byte_swap32_pattern>::type;
+
+template <typename Shuffle, typename Element, std::size_t... I> inline constexpr bool shuffle_scalar_check(std::index_sequence<I...>) {
+  const Element in[] = {static_cast<Element>(I * 3U + 1U)...};
+  Element out[sizeof...(I)] = {};
+  Shuffle::apply_scalar(in, out);
+  return ((out[I] == in[Shuffle::pattern[I]]) && ...);
+}
+
+class TestShuffle {
+  static_assert(shuffle<std::uint8_t, 0, 1, 2, 3>::is_identity, "Identity pattern");
+  static_assert(!shuffle<std::uint8_t, 1, 0, 2, 3>::is_identity, "Not identity pattern");
+  static_assert(shuffle<std::uint32_t, 3U, 2U, 1U, 0U>::is_dword && (0x1B == shuffle<std::uint32_t, 3U, 2U, 1U, 0U>::dword_mask), "Reverse dwords");
+  static_assert(shuffle<std::uint8_t, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11>::is_dword, "Bytes that move whole dwords");
+  static_assert(0xB1 == shuffle<std::uint8_t, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11>::dword_mask, "Dword immediate from bytes");
+  static_assert(!ByteSwap32::is_dword && !ByteSwap32::is_identity && (16U == ByteSwap32::size), "Byte swap needs pshufb");
+  static_assert(!shuffle<std::uint8_t, 5, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11>::is_dword, "Broken dword group");
+  static_assert(shuffle_scalar_check<ByteSwap32, std::uint8_t>(std::make_index_sequence<16>{}), "Scalar byte swap");
+  static_assert(shuffle_scalar_check<shuffle<std::uint32_t, 7, 0, 6, 1, 5, 2, 4, 3>, std::uint32_t>(std::make_index_sequence<8>{}),
+                "Scalar dword permutation");
+  static_assert(shuffle_scalar_check<shuffle<std::uint16_t, 2, 2, 0>, std::uint16_t>(std::make_index_sequence<3>{}), "Scalar with repeats");
+};
+
+using Q15 = fixed_point<0U, 15U>;
+using Q7 = fixed_point<0U, 7U, Rounding::Nearest>;
+using Q8_8 = fixed_point<7U, 8U, Rounding::Nearest, Overflow::Saturate>;
+using Q3_4Wrap = fixed_point<3U, 4U, Overflow::Wrap>;
+using Q31 = fixed_point<0U, 31U, Rounding::Nearest>;
+
+class TestFixedPoint {
+  static_assert(std::is_same_v<Q15::storage, std::int16_t> && std::is_same_v<Q7::storage, std::int8_t>, "Storage according to the width");
+  static_assert((Rounding::Truncate == Q15::ROUNDING_MODE) && (Overflow::Saturate == Q15::OVERFLOW_MODE), "Default policies");
+  static_assert((Rounding::Nearest == Q8_8::ROUNDING_MODE) && (Overflow::Wrap == Q3_4Wrap::OVERFLOW_MODE), "Given policies");
+
+  static_assert(256 == Q8_8(const_v<1>).raw(), "Integral constant");
+  static_assert(-1280 == Q8_8(const_v<-5>).raw(), "Negative integral constant");
+  static_assert(3 == Q8_8(const_v<3>).to<int>(), "Integral value back");
+  static_assert(-1 == Q8_8::from_raw(-1).to<int>(), "Integral value rounds toward minus infinity");
+
+  // Conversions: one shift with the policy of the destination
+  static_assert(0x4000 == Q15(Q7::from_raw(0x40)).raw(), "Widen Q7 to Q15");
+  static_assert(0x40 == Q7(Q15::from_raw(0x4000)).raw(), "Narrow Q15 to Q7");
+  static_assert(0x41 == Q7(Q15::from_raw(0x40C0)).raw(), "Narrow with rounding to nearest");
+  static_assert(0x40 == fixed_point<0U, 7U>(Q15::from_raw(0x40FF)).raw(), "Narrow with truncation");
+  static_assert(127 == Q7(Q8_8(const_v<2>)).raw(), "Narrow with saturation to max");
+  static_assert(-128 == Q7(Q8_8(const_v<-2>)).raw(), "Narrow with saturation to min");
+  static_assert(-16 == Q3_4Wrap(Q8_8(const_v<15>)).raw(), "Narrow with wrap");
+
+  // Arithmetic
+  static_assert(Q8_8(const_v<5>) == Q8_8(const_v<2>) + Q8_8(const_v<3>), "Addition");
+  static_assert(Q8_8(const_v<-1>) == Q8_8(const_v<2>) - Q8_8(const_v<3>), "Subtraction");
+  static_assert(Q8_8(const_v<6>) == Q8_8(const_v<2>) * Q8_8(const_v<3>), "Multiplication");
+  static_assert(Q8_8::from_raw(0x80) == Q8_8(const_v<1>) / Q8_8(const_v<2>), "Division");
+  static_assert((Q8_8::from_raw(171) == Q8_8(const_v<2>) / Q8_8(const_v<3>)) && (Q8_8::from_raw(-171) == Q8_8(const_v<-2>) / Q8_8(const_v<3>)) &&
+                    (Q8_8::from_raw(-171) == Q8_8(const_v<2>) / Q8_8(const_v<-3>)),
+                "Division rounded to the nearest");
+  static_assert((Q15::from_raw(10922) == Q15::from_raw(0x2000) / Q15::from_raw(0x6000)) &&
+                    (Q15::from_raw(-10923) == Q15::from_raw(-0x2000) / Q15::from_raw(0x6000)),
+                "Division truncated as the shift (toward minus infinity)");
+  static_assert((Q31::from_raw(0x7FFFFFFF) == Q31::from_raw(INT32_MIN) / Q31::from_raw(INT32_MIN)) &&
+                    (Q31::from_raw(INT32_MIN) == Q31::from_raw(INT32_MIN) / Q31::from_raw(0x7FFFFFFF)) &&
+                    (Q31::from_raw(-0x40000000) == Q31::from_raw(0x40000000) / Q31::from_raw(INT32_MIN)),
+                "Q0.31 division of the widest values");
+  static_assert(Q8_8::from_raw(0x7FFF) == Q8_8(const_v<100>) + Q8_8(const_v<100>), "Addition with saturation");
+  static_assert(Q8_8::from_raw(-0x8000) == Q8_8(const_v<-100>) * Q8_8(const_v<2>), "Multiplication with saturation");
+  static_assert(Q3_4Wrap(const_v<-8>) == Q3_4Wrap(const_v<4>) + Q3_4Wrap(const_v<4>), "Addition with wrap");
+  static_assert(0x4000 == (Q15::from_raw(0x7FFF) * Q15::from_raw(0x4000)).raw() + 1, "Q15 multiplication truncates");
+  static_assert(Q7::from_raw(1) == Q7::from_raw(0x0B) * Q7::from_raw(0x06), "Q7 multiplication rounds to nearest");
+  static_assert((Q7::from_raw(0x7F) == -Q7::from_raw(-0x80)) && (Q8_8(const_v<-3>) < Q8_8(const_v<2>)), "Negation and compare");
+
+#if __cpp_nontype_template_args >= 201911L
+  static_assert(0x4000 == Q15(const_v<0.5>).raw(), "Floating point constant");
+  static_assert(-0x2000 == Q15(const_v<-0.25>).raw(), "Negative floating point constant");
+  static_assert(0x55 == Q7(const_v<0.666>).raw(), "Floating point constant with rounding to nearest");
+  static_assert(0x7FFF == Q15(const_v<0.99997>).raw(), "Floating point constant at the edge");
+  static_assert(1.5 == Q8_8(const_v<1.5>).to<double>(), "Floating point value back");
+  static_assert((-77 == fixed_point<7U, 8U>(const_v<-0.3>).raw()) && (76 == fixed_point<7U, 8U>(const_v<0.3>).raw()) &&
+                    (-1 == fixed_point<7U, 8U>(const_v<-0.001>).raw()),
+                "Negative floating point constant truncated toward minus infinity");
+  static_assert((-77 == Q8_8(const_v<-0.3>).raw()) && (0 == Q8_8(const_v<-0.001953125>).raw()) && (-1 == Q8_8(const_v<-0.005859375>).raw()),
+                "Negative floating point constant rounded to the nearest (half up)");
+#endif
+};
+
+using Length = dimension<dim::Length{1}>;
+using Speed = dimension<dim::Time{-1}, dim::Length{1}>;
+using Metres = quantity<int, Length>;
+using Millimetres = quantity<int, Length, 1, 1000>;
+using Kilometres = quantity<int, Length, 1000>;
+using MetresPerSecond = quantity<float, Speed>;
+using KilometresPerHour = quantity<float, Speed, 1000, 3600>;
+using Seconds = quantity<int, dimension<dim::Time{1}>>;
+
+class TestQuantity {
+  static_assert((1 == Speed::LENGTH) && (-1 == Speed::TIME) && (0 == Speed::MASS), "Exponents from the pack");
+  static_assert(std::is_same_v<Speed::canonical, dimension<dim::Length{1}, dim::Time{-1}>::canonical>, "Order of exponents is not important");
+  static_assert(std::is_same_v<Length::combine<Length>::canonical, dimension<dim::Length{2}>::canonical>, "Product of dimensions");
+  static_assert(std::is_same_v<Length::combine<Length, -1>::canonical, dimension<>::canonical>, "Quotient of dimensions");
+  static_assert((5 == KilometresPerHour::NUM) && (18 == KilometresPerHour::DEN), "Ratio is reduced");
+
+  // Conversion factor is one folded constant
+  static_assert((1000 == Metres::conversion<Kilometres>::FACTOR_NUM) && (1 == Metres::conversion<Kilometres>::FACTOR_DEN), "km to m");
+  static_assert((1 == Kilometres::conversion<Millimetres>::FACTOR_NUM) && (1000000 == Kilometres::conversion<Millimetres>::FACTOR_DEN),
+                "mm to km");
+  static_assert((18 == KilometresPerHour::conversion<MetresPerSecond>::FACTOR_NUM) && (5 == KilometresPerHour::conversion<MetresPerSecond>::FACTOR_DEN),
+                "m/s to km/h");
+
+  static_assert(Metres(const_v<2000>) == Metres(Kilometres(const_v<2>)), "Convert km to m");
+  static_assert(Kilometres(const_v<3>) == Kilometres(Millimetres(const_v<3500000>)), "Convert mm to km");
+  static_assert(36.0F == KilometresPerHour(MetresPerSecond(const_v<10>)).count(), "Convert m/s to km/h");
+  static_assert(Metres(const_v<7>) == Metres(const_v<3>) + Metres(const_v<4>), "Same unit addition");
+  static_assert(Metres(const_v<-1>) == Metres(const_v<3>) - 2 * Metres(const_v<2>), "Same unit subtraction and scaling");
+  static_assert(std::is_same_v<decltype(Metres(const_v<1>) / Seconds(const_v<1>))::dimension_type, Speed::canonical>, "Speed from length and time");
+  static_assert(5 == (Metres(const_v<10>) / Seconds(const_v<2>)).count(), "Division of quantities");
+  static_assert(3000 == Metres(Kilometres(const_v<1>) * Metres(const_v<3>) / Metres(const_v<1>)).count(), "Product keeps the ratio");
+  static_assert((Metres(const_v<3>) < Metres(const_v<4>)) && (Metres(const_v<4>) > Metres(const_v<3>)) && !(Metres(const_v<3>) > Metres(const_v<3>)),
+                "Strict comparison");
+  static_assert((Metres(const_v<3>) <= Metres(const_v<4>)) && (Metres(const_v<3>) <= Metres(const_v<3>)) && !(Metres(const_v<4>) <= Metres(const_v<3>)) &&
+                    (Metres(const_v<4>) >= Metres(const_v<3>)) && (Metres(const_v<3>) >= Metres(const_v<3>)) && !(Metres(const_v<3>) >= Metres(const_v<4>)),
+                "Non-strict comparison");
+  static_assert(Metres(Kilometres(const_v<1>)) >= Metres(const_v<1000>), "Comparison after the conversion");
+};
+
+using Matrix23 = matrix<int, 2, 3>;
+using Matrix32 = matrix<int, 3, 2>;
+
+class TestMatrix {
+  static constexpr Matrix23 a{{{1, 2, 3}, {4, 5, 6}}};
+  static constexpr Matrix32 b{{{7, 8}, {9, 10}, {11, 12}}};
+  static constexpr matrix<double, 3, 3> spd{{{4.0, 2.0, -2.0}, {2.0, 10.0, 2.0}, {-2.0, 2.0, 5.0}}};
+  static constexpr ldlt<double, 3> factor{spd};
+
+  static_assert((2 == Matrix23::ROWS) && (3 == Matrix23::COLS) && (6 == a(1, 2)), "Sizes and access");
+  static_assert((a * b) == matrix<int, 2, 2>{{{58, 64}, {139, 154}}}, "Product");
+  static_assert((b * a) == matrix<int, 3, 3>{{{39, 54, 69}, {49, 68, 87}, {59, 82, 105}}}, "Product in other order");
+  static_assert(a.transpose() == Matrix32{{{1, 4}, {2, 5}, {3, 6}}}, "Transpose");
+  static_assert((a + a) == (2 * a) && ((a - a) == Matrix23{}), "Element-wise operations");
+  static_assert((matrix<int, 3, 3>::identity() * b) == b, "Identity");
+  static_assert((a * vec<int, 3>{{{1}, {0}, {-1}}}) == vec<int, 2>{{{-2}, {-2}}}, "Matrix by vector");
+  static_assert((4.0 == factor.d(0, 0)) && (9.0 == factor.d(1, 0)) && (3.0 == factor.d(2, 0)), "LDL^T diagonal");
+  static_assert((0.5 == factor.l(1, 0)) && (-0.5 == factor.l(2, 0)) && (1.0 / 3.0 == factor.l(2, 1)), "LDL^T lower factor");
+  static_assert(factor.solve(spd * vec<double, 3>{{{1.0}, {-2.0}, {3.0}}}) == vec<double, 3>{{{1.0}, {-2.0}, {3.0}}}, "LDL^T solve");
+  static_assert(factor.valid && !ldlt<double, 2>{matrix<double, 2, 2>{{{1.0, 2.0}, {2.0, 4.0}}}}.valid &&
+                    !ldlt<double, 2>{matrix<double, 2, 2>{{{1.0, 2.0}, {2.0, 1.0}}}}.valid && !ldlt<double, 2>{matrix<double, 2, 2>{}}.valid,
+                "Singular or indefinite matrix is reported");
+  static_assert(0.0 == ldlt<double, 2>{matrix<double, 2, 2>{{{0.0, 1.0}, {1.0, 0.0}}}}.l(1, 0), "No division by the zero pivot");
+};
+
+enum class MessageId : std::uint16_t { Telemetry = 0x0102 };
+enum class Sequence : std::uint32_t {};
+using Temperature = std::int16_t;
+using Telemetry = schema<field<MessageId, 0, Endian::Big>, field<Sequence, 2>, field<Temperature, 8, Endian::Big>>;
+
+template <typename... Values> inline constexpr auto encode_telemetry(const Values... values) {
+  struct {
+    std::byte data[Telemetry::SIZE];
+  } buffer{};
+  Telemetry::encode(buffer.data, values...);
+  return buffer;
+}
+
+class TestSchema {
+  static constexpr std::byte raw[] = {std::byte{0x01}, std::byte{0x02}, std::byte{0x78}, std::byte{0x56}, std::byte{0x34},
+                                      std::byte{0x12}, std::byte{0xEE}, std::byte{0xEE}, std::byte{0xFF}, std::byte{0x38}};
+  static constexpr auto encoded = encode_telemetry(Temperature{-200}, Sequence{0x12345678U}, MessageId::Telemetry);
+
+  static_assert((0x3412 == byte_swap(std::uint16_t{0x1234})) && (0x78563412U == byte_swap(0x12345678U)), "Byte swap 16 and 32 bits");
+  static_assert(0x0807060504030201ULL == byte_swap(0x0102030405060708ULL), "Byte swap 64 bits");
+  static_assert(10U == Telemetry::SIZE, "Size with a gap");
+  static_assert(MessageId::Telemetry == Telemetry::decode(raw).get<MessageId>(), "Big endian field");
+  static_assert(Sequence{0x12345678U} == Telemetry::decode(raw).get<Sequence>(), "Little endian field");
+  static_assert(-200 == Telemetry::get<Temperature>(raw), "Signed field");
+  static_assert(std::byte{0x01} == encoded.data[0] && std::byte{0x02} == encoded.data[1] && std::byte{0x78} == encoded.data[2], "Encode");
+  static_assert(std::byte{0x00} == encoded.data[6] && std::byte{0xFF} == encoded.data[8] && std::byte{0x38} == encoded.data[9], "Encode with gap");
+  static_assert(Sequence{} == Telemetry::decode(encode_telemetry(MessageId::Telemetry).data).get<Sequence>(), "Missed field is zero");
+};
+
+enum class IpVersion : std::uint8_t { V4 = 4, V6 = 6 };
+enum class FlowLabel : std::uint32_t {};
+enum class PayloadLength : std::uint16_t {};
+enum class TrafficClass : std::uint8_t {};
+// IPv6 header start: version (4 bits), traffic class (8 bits), flow label (20 bits), payload length
+using Ipv6Header = schema<bit_field<IpVersion, 0, 4>, bit_field<TrafficClass, 4, 8>, bit_field<FlowLabel, 12, 20>, field<PayloadLength, 4, Endian::Big>>;
+using Flags = schema<bit_field<bool, 0, 1, Endian::Little>, bit_field<std::uint16_t, 1, 11, Endian::Little>>;
+
+inline constexpr auto encode_flags(const bool flag, const std::uint16_t value) {
+  struct {
+    std::byte data[Flags::SIZE];
+  } buffer{};
+  buffer.data[1] = std::byte{0xF0};
+  Flags::encode(buffer.data, value, flag);
+  return buffer;
+}
+
+class TestFrame {
+  static constexpr std::byte ipv6[] = {std::byte{0x6A}, std::byte{0xB1}, std::byte{0x23}, std::byte{0x45}, std::byte{0x05}, std::byte{0xDC}};
+  static constexpr auto flags = encode_flags(true, 0x5A5U);
+
+  static_assert((6U == Ipv6Header::SIZE) && (2U == Flags::SIZE), "Size with bit fields");
+  static_assert(IpVersion::V6 == Ipv6Header::decode(ipv6).get<IpVersion>(), "Upper nibble");
+  static_assert(TrafficClass{0xAB} == Ipv6Header::decode(ipv6).get<TrafficClass>(), "Bits across bytes");
+  static_assert(FlowLabel{0x12345} == Ipv6Header::decode(ipv6).get<FlowLabel>(), "20 bits in 3 bytes");
+  static_assert(PayloadLength{1500} == Ipv6Header::decode(ipv6).get<PayloadLength>(), "Byte field after bit fields");
+  static_assert(Flags::get<bool>(flags.data) && (0x5A5U == Flags::get<std::uint16_t>(flags.data)), "Little endian bit fields round trip");
+  static_assert((std::byte{0x4B} == flags.data[0]) && (std::byte{0xFB} == flags.data[1]), "Store keeps other bits");
+};
+
+inline constexpr Endian foreign_endian = (Endian::Little == native_endian) ? Endian::Big : Endian::Little;
+static constexpr std::uint16_t table16[] = {0x0102U, 0xA0B0U};
+static constexpr std::uint32_t table32[] = {0x01020304UL, 0xDEADBEEFUL, 0U};
+static constexpr std::uint64_t table64[] = {0x0102030405060708ULL};
+static constexpr TestType4 table_enum[] = {TestType4::TestValue1, TestType4::TestValue2};
+
+class TestEndian {
+  static_assert(0x1234U == to_endian<native_endian>(std::uint16_t{0x1234U}), "No operation for native");
+  static_assert(0x3412U == to_endian<foreign_endian>(std::uint16_t{0x1234U}), "Swap for foreign");
+  static_assert(0x04030201U == endian_v<foreign_endian, 0x01020304U>.value, "Scalar const_v");
+  static_assert(0x0807060504030201ULL == decltype(to_endian<foreign_endian>(const_v<0x0102030405060708ULL>))::value, "Scalar const_v as parameter");
+
+  static_assert(&endian_array<native_endian, table32>::value == &table32, "Native array is not copied");
+  static_assert(&endian_array<foreign_endian, table32>::value != &table32, "Foreign array is a copy");
+  static_assert((0x0201U == endian_array<foreign_endian, table16>::value[0]) && (0xB0A0U == endian_array<foreign_endian, table16>::value[1]),
+                "16-bit table");
+  static_assert((0x04030201UL == endian_ref_v<foreign_endian, table32>.value[0]) && (0xEFBEADDEUL == endian_ref_v<foreign_endian, table32>.value[1]),
+                "32-bit table");
+  static_assert(0x0807060504030201ULL == decltype(to_endian<foreign_endian>(const_ref_v<table64>))::value[0], "64-bit table");
+  static_assert(3U == std::extent_v<std::remove_reference_t<decltype(endian_array<foreign_endian, table32>::value)>>, "Size is kept");
+  static_assert(TestType4::TestValue1 == byte_swap(endian_array<foreign_endian, table_enum>::value[0]), "Enumeration table");
+};
+
+struct Clock {};
+struct Gpio {
+  using dependencies = type_list<Clock>;
+};
+struct Dma {
+  using dependencies = type_list<Clock>;
+};
+struct Uart {
+  using dependencies = type_list<Gpio, Dma, Clock>;
+};
+struct Logger {
+  using dependencies = type_list<Uart>;
+};
+struct Watchdog {};
+using Board = dependency_graph<Logger, Uart, Dma, Watchdog, Gpio, Clock>;
+
+template <typename Graph> inline constexpr std::size_t count_components() {
+  std::size_t count = 0;
+  Graph::for_each_level([&count](const auto level) { level.for_each([&count](const auto) { count++; }); });
+  return count;
+}
+
+class TestDependencyGraph {
+  static_assert(std::is_same_v<type_list_cat_t<type_list<TestType1>, type_list<>, type_list<TestType2, TestType3>>, type_list<TestType1, TestType2, TestType3>>,
+                "Type lists concatenation");
+  static_assert(4U == Board::LEVELS, "Number of levels");
+  static_assert((0U == Board::level_of<Clock>) && (0U == Board::level_of<Watchdog>) && (1U == Board::level_of<Dma>) && (3U == Board::level_of<Logger>),
+                "Level of components");
+  static_assert(std::is_same_v<Board::levels_list, type_list<type_list<Watchdog, Clock>, type_list<Dma, Gpio>, type_list<Uart>, type_list<Logger>>>,
+                "Levels keep the given order inside");
+  static_assert(std::is_same_v<Board::order, type_list<Watchdog, Clock, Dma, Gpio, Uart, Logger>>, "Dependency order");
+  static_assert(6U == count_components<Board>(), "Every component is visited");
+  static_assert(std::is_same_v<dependency_graph<TestType1>::order, type_list<TestType1>>, "One component");
+};
+
+#ifdef ISO_META_TYPE_HOST
+// Trace of the task runs (for the host test): number of runs, start and finish ticks of every task of Pipeline
+inline std::atomic<std::size_t> task_clock;
+inline std::atomic<std::size_t> task_runs[4];
+inline std::atomic<std::size_t> task_started[4];
+inline std::atomic<std::size_t> task_finished[4];
+
+inline void trace_task(const std::size_t task) {
+  task_started[task] = ++task_clock;
+  task_runs[task]++;
+  // Let other workers run, so independent tasks overlap
+  std::this_thread::yield();
+  task_finished[task] = ++task_clock;
+}
+#else
+inline void trace_task(const std::size_t) {}
+#endif
+
+// Argument of 'trace_task' is the index of the task in Pipeline
+struct Load {
+  static void run() { trace_task(3U); }
+};
+struct Filter {
+  using dependencies = type_list<Load>;
+  static void run() { trace_task(2U); }
+};
+struct Reduce {
+  using dependencies = type_list<Load>;
+  static void run() { trace_task(1U); }
+};
+struct Store {
+  using dependencies = type_list<Filter, Reduce>;
+  static void run() { trace_task(0U); }
+};
+using Pipeline = task_graph<Store, Reduce, Filter, Load>;
+
+class TestTaskGraph {
+  static_assert((4U == Pipeline::SIZE) && (3U == Pipeline::index_v<Load>), "Task indexes");
+  static_assert((2U == Pipeline::resolved.dependencies[0]) && (0U == Pipeline::resolved.dependencies[3]), "Dependency counts");
+  static_assert((3U == Pipeline::resolved.sequence[0]) && (0U == Pipeline::resolved.sequence[3]), "Topological order");
+  static_assert((2U == Pipeline::resolved.first[4] - Pipeline::resolved.first[3]) && (1U == Pipeline::resolved.successors[Pipeline::resolved.first[3]]),
+                "Successors of the first task");
+  static_assert((0U == Pipeline::resolved.successors[Pipeline::resolved.first[1]]) && (Pipeline::resolved.first[0] == Pipeline::resolved.first[1]),
+                "Successors of the middle and the last tasks");
+  static_assert((&Filter::run == Pipeline::runners[2]) && (3U == Pipeline::index_v<Load>) && (2U == Pipeline::index_v<Filter>) &&
+                    (1U == Pipeline::index_v<Reduce>) && (0U == Pipeline::index_v<Store>),
+                "Runners in the order of the pack (the same as the indexes of 'trace_task')");
+};
+
+// Order of the service destructors (for the host test)
+inline std::uint8_t service_destroyed[3];
+inline std::size_t service_destroyed_count;
+
+struct Config {
+  std::uint8_t level;
+  ~Config() { service_destroyed[service_destroyed_count++] = 1U; }
+};
+struct Transport {
+  using dependencies = type_list<Config>;
+  Config &config;
+  explicit Transport(Config &c) : config(c) { c.level++; }
+  ~Transport() { service_destroyed[service_destroyed_count++] = 2U; }
+};
+struct Service {
+  using dependencies = type_list<Transport, Config>;
+  std::uint64_t counter = 0;
+  Transport &transport;
+  Service(Transport &t, Config &c) : counter(c.level), transport(t) {}
+  ~Service() { service_destroyed[service_destroyed_count++] = 3U; }
+};
+using Services = service_container<Service, Config, Transport>;
+
+class TestServiceContainer {
+  static constexpr std::size_t config_offset = (sizeof(Service) + alignof(Config) - 1U) / alignof(Config) * alignof(Config);
+  static constexpr std::size_t transport_offset =
+      (config_offset + sizeof(Config) + alignof(Transport) - 1U) / alignof(Transport) * alignof(Transport);
+
+  static_assert((0U == Services::offset_v<Service>) && (config_offset == Services::offset_v<Config>), "Services are placed in the pack order");
+  static_assert((transport_offset == Services::offset_v<Transport>) && !(Services::offset_v<Transport> % alignof(Transport)), "Alignment");
+  static_assert(Services::SIZE == Services::offset_v<Transport> + sizeof(Transport), "Size of the block");
+  static_assert(std::is_same_v<Services::order, type_list<Config, Transport, Service>>, "Construction order");
+};
+
+static constexpr int view_table[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+inline constexpr int copy_middle() {
+  int out[4] = {};
+  view(const_ref_v<view_table>).slice<2, 4>().copy_to(out);
+  return out[0] * 1000 + out[1] * 100 + out[2] * 10 + out[3];
+}
+
+// Out of range slices are substitution failures (detection idiom)
+template <typename View, const std::size_t subOffset, typename = void> struct can_slice : std::false_type {};
+template <typename View, const std::size_t subOffset>
+struct can_slice<View, subOffset, std::void_t<decltype(View{}.template slice<subOffset>())>> : std::true_type {};
+
+template <typename View, const std::size_t count, typename = void> struct can_take_last : std::false_type {};
+template <typename View, const std::size_t count>
+struct can_take_last<View, count, std::void_t<decltype(View{}.template last<count>())>> : std::true_type {};
+
+template <typename View, const std::size_t subOffset, const std::size_t subLength, typename = void> struct has_subview : std::false_type {};
+template <typename View, const std::size_t subOffset, const std::size_t subLength>
+struct has_subview<View, subOffset, subLength, std::void_t<typename View::template subview<subOffset, subLength>>> : std::true_type {};
+
+class TestStaticView {
+  static_assert(std::is_empty_v<static_view<view_table>> && (8U == static_view<view_table>::SIZE), "Empty type with the whole array");
+  static_assert(36 == view(const_ref_v<view_table>).sum(), "Sum of the whole view");
+  static_assert((3U == decltype(view(const_ref_v<view_table>).slice<2>().slice<1, 3>())::SIZE) &&
+                    (3U == decltype(view(const_ref_v<view_table>).slice<2>().slice<1, 3>())::OFFSET),
+                "Slice of the slice is resolved at compile time");
+  static_assert(21 == view(const_ref_v<view_table>).last<3>().sum(), "Last elements");
+  static_assert(6 == view(const_ref_v<view_table>).first<3>().reduce(1, [](const int a, const int b) { return a * b; }), "Product of first elements");
+  static_assert((4 == static_view<view_table, 3>::get<0>()) && (6 == static_view<view_table>::subview<4, 2>{}[1]), "Element access");
+  static_assert(3456 == copy_middle(), "Copy");
+  static_assert((2U == static_view<view_table, 6>::SIZE) && (0U == static_view<view_table, 8>::SIZE), "Default length of the view");
+  static_assert(can_slice<static_view<view_table>, 8>::value && !can_slice<static_view<view_table>, 9>::value &&
+                    !can_slice<static_view<view_table, 0, 4>, 6>::value && !can_slice<static_view<view_table, 4>, 6>::value,
+                "Slice out of the view");
+  static_assert(can_take_last<static_view<view_table, 4>, 4>::value && !can_take_last<static_view<view_table, 4>, 6>::value, "Last out of the view");
+  static_assert(has_subview<static_view<view_table, 2, 4>, 1, 3>::value && !has_subview<static_view<view_table, 2, 4>, 2, 3>::value &&
+                    !has_subview<static_view<view_table, 2, 4>, 5, 0>::value && !has_subview<static_view<view_table>, 1, ~std::size_t{0}>::value,
+                "Sub-view out of the view");
+};
+
+struct TestRegisters {
+  volatile std::uint32_t control;
+  volatile std::uint32_t status;
+  volatile std::uint32_t data;
+};
+// Host substitution of the peripheral memory
+inline TestRegisters test_peripheral_memory;
+using TestPeripheral = peripheral<TestRegisters, mut_ref_t<test_peripheral_memory>>;
+using TestFixedPeripheral = peripheral<TestRegisters, const_t<0x40011000UL>>;
+
+class TestPeripheralHandle {
+  static_assert(is_const_v<TestPeripheral> && is_const_v<TestFixedPeripheral>, "Handle is a const value");
+  static_assert(is_writable_ref_v<mut_ref_t<test_peripheral_memory>> && !is_const_ref_v<mut_ref_t<test_peripheral_memory>> &&
+                    !is_writable_ref_v<const_ref_t<test_peripheral_memory>> && !is_const_ref_v<TestPeripheral> && !is_const_v<TestRegisters>,
+                "Reference traits");
+  static_assert(std::is_same_v<const_ref_t<test_peripheral_memory>::type, const TestRegisters &> &&
+                    std::is_same_v<mut_ref_t<test_peripheral_memory>::type, TestRegisters &>,
+                "Constant reference keeps the object constant");
+  static_assert(std::is_empty_v<TestPeripheral> && std::is_empty_v<TestFixedPeripheral>, "Handle is empty");
+  static_assert((0x40011000UL == TestFixedPeripheral::value) && (&TestPeripheral::value == &test_peripheral_memory), "Base address");
+#ifdef __cpp_concepts
+  static_assert(const_value<TestPeripheral> && const_value<TestFixedPeripheral>, "Handle satisfies the concept");
+  static_assert(mutable_reference<mut_ref_t<test_peripheral_memory>> && !const_reference<mut_ref_t<test_peripheral_memory>> &&
+                    const_reference_of_type<const_ref_t<test_peripheral_memory>, const TestRegisters &>,
+                "Reference concepts");
+#endif
+};
+
+static constexpr std::uint32_t dma_header[2] = {0xAA55U, 0x10U};
+static constexpr std::uint32_t dma_payload[4] = {1U, 2U, 3U, 4U};
+inline std::uint32_t dma_buffer[8];
+using TestChain = dma_chain<4U, decltype(segment(const_ref_v<dma_header>, mut_ref_v<dma_buffer>, const_v<8U>)),
+                            dma_segment<const_ref_t<dma_payload>, mut_ref_t<dma_buffer>, const_t<16U>, 0x3U>>;
+
+class TestDmaChain {
+  static_assert((2U == TestChain::SIZE) && (24U == TestChain::LENGTH), "Chain size");
+  static_assert((TestChain::value[0].source == dma_header) && (TestChain::value[0].destination == dma_buffer), "First descriptor addresses");
+  static_assert((8U == TestChain::value[0].length) && (0U == TestChain::value[0].control) && (TestChain::value[0].next == &TestChain::value[1]),
+                "First descriptor");
+  static_assert((TestChain::value[1].source == dma_payload) && (16U == TestChain::value[1].length) && (0x3U == TestChain::value[1].control),
+                "Second descriptor");
+  static_assert(nullptr == TestChain::value[1].next, "Last descriptor ends the chain");
+  static_assert(is_writable_ref_v<mut_ref_t<dma_buffer>> && !is_writable_ref_v<const_ref_t<dma_buffer>> && !is_writable_ref_v<const_ref_t<dma_header>>,
+                "Only mut_ref_t is a DMA destination");
+  static_assert(std::is_same_v<decltype(segment(mut_ref_v<dma_buffer>, mut_ref_v<dma_buffer>, const_v<8U>))::source_type, std::uint32_t[8]>,
+                "Writable object as the source");
+  static_assert(&dma_chain_v<4U, decltype(segment(const_ref_v<dma_header>, mut_ref_v<dma_buffer>, const_v<8U>))>.value[0] ==
+                    &dma_chain<4U, decltype(segment(const_ref_v<dma_header>, mut_ref_v<dma_buffer>, const_v<8U>))>::value[0],
+                "Chain as const_ref_v");
+};
+
+static constexpr char board_config[] = R"(
+# Board configuration
+baudrate = 115200
+trace = true
+
+[led]
+port = 1
+pin = 0x0D
+mode = 1
+; Speed is given in binary
+speed = 0b11
+
+[button]
+port=0
+pin = 3
+mode = 0
+pull = 2
+name = user button
+)";
+using BoardConfig = config<board_config>;
+
+enum class TestPort { PA, PB };
+enum class TestPin : unsigned {};
+enum class TestMode : unsigned { Input, Output };
+enum class TestSpeed : unsigned { Low, Medium, High = 0b11 };
+enum class TestPull : unsigned { None, Up, Down };
+
+// Configuration structure validated with var_pack the same way as README example
+struct TestGpioConfig {
+  TestPort port;
+  TestPin pin;
+  TestMode mode;
+  TestSpeed speed;
+  TestPull pull;
+
+  template <typename... AddParams>
+  constexpr TestGpioConfig(const TestPort p_Port, const TestPin p_Pin, const TestMode p_Mode, const AddParams... p_AddParams)
+      : port(p_Port), pin(p_Pin), mode(p_Mode), speed(var_pack::type<TestSpeed>::get(p_AddParams...)),
+        pull(var_pack::type<TestPull>::get(p_AddParams...)) {
+    static_assert(var_pack::is_types_unique_v<AddParams...> && var_pack::is_type_list<TestSpeed, TestPull>::contains_v<AddParams...>,
+                  "Wrong additional parameters");
+  }
+};
+
+class TestConfig {
+  static constexpr TestGpioConfig led{BoardConfig::get<TestPort>("led.port"), BoardConfig::get<TestPin>("led.pin"),
+                                      BoardConfig::get<TestMode>("led.mode"), BoardConfig::get<TestSpeed>("led.speed", TestSpeed::Low)};
+  static constexpr TestGpioConfig button{BoardConfig::get<TestPort>("button.port"), BoardConfig::get<TestPin>("button.pin"),
+                                         BoardConfig::get<TestMode>("button.mode"), BoardConfig::get<TestPull>("button.pull", TestPull::None)};
+
+  static_assert(11U == BoardConfig::SIZE, "Number of entries");
+  static_assert((115200U == BoardConfig::get<unsigned>("baudrate")) && BoardConfig::get<bool>("trace"), "Global keys");
+  static_assert((TestPort::PB == led.port) && (TestPin{13} == led.pin) && (TestSpeed::High == led.speed) && (TestPull::None == led.pull),
+                "Configuration structure from the section");
+  static_assert((TestPort::PA == button.port) && (TestPull::Down == button.pull), "Configuration structure from other section");
+  static_assert(BoardConfig::contains("led.pin") && !BoardConfig::contains("pin") && !BoardConfig::contains("led.pull"), "Keys in sections");
+  static_assert("user button" == BoardConfig::get<std::string_view>("button.name"), "Text value");
+  static_assert(-5 == BoardConfig::get<int>("led.offset", -5), "Default value");
+  static_assert(BoardConfig::valid<TestPin>("led.pin") && !BoardConfig::valid<bool>("led.pin") && !BoardConfig::valid<int>("led.offset"),
+                "Value check without the diagnostic");
+};
+
+static constexpr char range_config[] = R"(
+pin = 300
+byte = 255
+negative = -1
+lowest = -128
+wide = 12345678901234567890123
+hex = 0xFFFFFFFFFFFFFFFF
+)";
+using RangeConfig = config<range_config>;
+
+class TestConfigRange {
+  static_assert(!RangeConfig::valid<std::uint8_t>("pin") && RangeConfig::valid<std::uint16_t>("pin") &&
+                    (300U == RangeConfig::get<std::uint16_t>("pin")),
+                "Value out of the range of the type");
+  static_assert((255U == RangeConfig::get<std::uint8_t>("byte")) && !RangeConfig::valid<std::int8_t>("byte"), "Largest value of the type");
+  static_assert(!RangeConfig::valid<unsigned>("negative") && !RangeConfig::valid<TestPin>("negative") && (-1 == RangeConfig::get<int>("negative")),
+                "Negative value for unsigned type");
+  static_assert((-128 == RangeConfig::get<std::int8_t>("lowest")) && !RangeConfig::valid<std::uint8_t>("lowest"), "Lowest value of the type");
+  static_assert(!RangeConfig::valid<unsigned long long>("wide") && !RangeConfig::valid<long long>("wide"), "Overflow of the widest type");
+  static_assert((~0ULL == RangeConfig::get<std::uint64_t>("hex")) && !RangeConfig::valid<std::int64_t>("hex") &&
+                    !RangeConfig::valid<std::uint32_t>("hex"),
+                "Largest hexadecimal value");
+};
+
+static constexpr char http_request[] = "(GET|POST|PUT) /[a-z0-9_/]*";
+static constexpr char decimal_number[] = "-?\\d+(\\.\\d+)?";
+static constexpr char log_error[] = "[^ ]+: (error|fatal) code=0x[0-9a-fA-F]+";
+static constexpr char empty_pattern[] = "";
+static constexpr char nested_star[] = "(a*)*b";
+
+class TestRegex {
+  using Http = regex<http_request>;
+  using Number = regex<decimal_number>;
+  using Error = regex<log_error>;
+
+  static_assert(Http::match("GET /api/v1") && Http::match("PUT /") && !Http::match("GET /API") && !Http::match("POST"), "Alternation and class");
+  static_assert(Http::search("> POST /upload HTTP/1.1") && !Http::search("GET api"), "Search inside the text");
+  static_assert(Number::match("42") && Number::match("-3.14") && !Number::match("3.") && !Number::match(".5") && !Number::match(""),
+                "Optional group and plus");
+  static_assert(Error::search("t=12 uart0: error code=0x1F, retry") && !Error::search("uart0: warning code=0x1F"), "Negated class");
+  static_assert(regex<empty_pattern>::match("") && !regex<empty_pattern>::match("a") && regex<empty_pattern>::search("a"), "Empty pattern");
+  static_assert(regex<nested_star>::match("aab") && regex<nested_star>::match("b") && !regex<nested_star>::match("aa"), "Nested star");
+  static_assert((Http::STATES<> < 32U) && (Http::CLASSES < 32U), "Compact transition table");
+};
+
+// Calibration curve: linear parts (runs of the same delta), noise and negative deltas
+static constexpr std::int16_t calibration_curve[] = {0,   10,  20,  30,  40,  50,  60,  70,  80,  90,  100, 105, 103, 108, 120, 120, 120, 120,
+                                                     120, 119, 117, 115, 113, 111, -32768, 32767, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+static constexpr std::uint32_t wide_table[] = {0xFFFFFFFFU, 0U, 0x80000000U, 0x7FFFFFFFU, 1U, 1U, 1U, 1U, 0xDEADBEEFU};
+static constexpr std::uint8_t glyph[16] = {0x00, 0x00, 0x00, 0x18, 0x3C, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+template <typename Table, typename Source, std::size_t size> constexpr bool round_trip(const Source (&source)[size]) {
+  Source out[size]{};
+  Table::decompress(out);
+  for (std::size_t i = 0; i < size; i++) {
+    if ((out[i] != source[i]) || (Table::at(i) != source[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Element access at compile time: index out of the table is not a constant expression (substitution failure)
+template <typename Table, const std::size_t index, typename = void> struct can_read_at : std::false_type {};
+template <typename Table, const std::size_t index>
+struct can_read_at<Table, index, std::void_t<std::integral_constant<typename Table::value_type, Table::at(index)>>> : std::true_type {};
+
+class TestCompressed {
+  using Curve = compressed<calibration_curve, 16U>;
+  using Wide = compressed<wide_table, 4U>;
+  using Glyph = compressed<glyph>;
+
+  static_assert(round_trip<Curve>(calibration_curve) && round_trip<Wide>(wide_table) && round_trip<Glyph>(glyph), "Round trip");
+  static_assert((3U == Curve::BLOCKS) && (Curve::BYTES < sizeof(calibration_curve)), "Compression");
+  static_assert([]() {
+    std::int16_t block[16]{};
+    return (4U == Curve::decode(2U, block)) && (6 == block[0]) && (9 == block[3]);
+  }(), "Last block is shorter");
+  static_assert([]() {
+    Curve::reader stream(15U);
+    const bool first = (120 == stream.next()) && (120 == stream.next()) && (17U == stream.index());
+    while (!stream.empty()) {
+      stream.next();
+    }
+    return first && (sizeof(calibration_curve) / sizeof(calibration_curve[0]) == stream.index());
+  }(), "Streaming from the middle of the block");
+  static_assert(can_read_at<Curve, 35U>::value && !can_read_at<Curve, 36U>::value && !can_read_at<Glyph, 100U>::value, "Index out of the table");
+  static_assert([]() {
+    std::int16_t block[16]{};
+    return 0U == Curve::decode(3U, block);
+  }(), "Block out of the table");
+};
+
+// Plain configuration structure (aggregate) of the same fields as TestGpioConfig
+struct TestGpioFields {
+  TestPort port;
+  TestPin pin;
+  TestMode mode;
+  TestSpeed speed;
+  TestPull pull;
+};
+
+struct TestNestedFields {
+  const std::uint8_t id;
+  TestGpioFields gpio;
+  std::string_view name;
+};
+
+struct TestNoFields {};
+
+class TestAggregate {
+  using Gpio = aggregate<TestGpioFields>;
+
+  static_assert((5U == Gpio::SIZE) && (3U == aggregate<TestNestedFields>::SIZE) && (0U == aggregate<TestNoFields>::SIZE), "Number of fields");
+  static_assert(std::is_same_v<Gpio::types, type_list<TestPort, TestPin, TestMode, TestSpeed, TestPull>> &&
+                    std::is_same_v<aggregate<TestNestedFields>::types, type_list<std::uint8_t, TestGpioFields, std::string_view>>,
+                "Types of fields");
+  static_assert(Gpio::types::is_unique() && Gpio::types::is_subset_of_v<TestPort, TestPin, TestMode, TestSpeed, TestPull, TestType6> &&
+                    !Gpio::types::is_subset_of_v<TestPort, TestPin>,
+                "Validation with var_pack");
+  static_assert([]() {
+    constexpr TestGpioFields gpio{TestPort::PB, TestPin{13}, TestMode::Output, TestSpeed::High, TestPull::Up};
+    // Serializer from the reflection: every field as one byte
+    std::uint8_t bytes[Gpio::SIZE]{};
+    std::size_t index = 0;
+    Gpio::for_each(gpio, [&bytes, &index](const auto &field) { bytes[index++] = static_cast<std::uint8_t>(field); });
+    const auto pin = Gpio::apply(gpio, [](const auto &, const auto &p_Pin, const auto &...) { return p_Pin; });
+    return (1U == bytes[0]) && (13U == bytes[1]) && (1U == bytes[2]) && (3U == bytes[3]) && (1U == bytes[4]) && (TestPin{13} == pin);
+  }(), "Fields access");
+};
+
+// Runtime options: move-only and non-structural types
+enum class TestTimeout : unsigned {};
+struct TestBatch {
+  int size;
+  constexpr explicit TestBatch(const int p_Size) : size(p_Size) {}
+  TestBatch(const TestBatch &) = delete;
+  constexpr TestBatch(TestBatch &&other) : size(other.size) { other.size = 0; }
+};
+struct TestPolicy {
+  std::string_view name;
+  double weight;
+};
+
+struct TestService {
+  TestTimeout timeout;
+  TestBatch batch;
+  TestPolicy policy;
+
+  template <typename... Options>
+  constexpr explicit TestService(Options &&...p_Options)
+      : timeout(var_pack::forward_type<TestTimeout>::get_or(TestTimeout{100}, std::forward<Options>(p_Options)...)),
+        batch(var_pack::forward_type<TestBatch>::get_or(TestBatch{16}, std::forward<Options>(p_Options)...)),
+        policy(var_pack::forward_type<TestPolicy>::get_or(TestPolicy{"fifo", 1.0}, std::forward<Options>(p_Options)...)) {
+    static_assert(var_pack::is_types_unique_v<std::decay_t<Options>...> &&
+                      var_pack::is_type_list<TestTimeout, TestBatch, TestPolicy>::contains_v<std::decay_t<Options>...>,
+                  "Wrong options");
+  }
+};
+
+class TestForwardType {
+  static_assert(var_pack::forward_type<TestBatch>::is_inside_v<int, const TestBatch &> && !var_pack::forward_type<TestBatch>::is_inside_v<int>,
+                "Type is inside the pack");
+  static_assert(std::is_same_v<decltype(var_pack::forward_type<TestBatch>::get(1, std::declval<TestBatch>())), TestBatch &&> &&
+                    std::is_same_v<decltype(var_pack::forward_type<TestBatch>::get(std::declval<const TestBatch &>(), 1)), const TestBatch &> &&
+                    std::is_same_v<decltype(var_pack::forward_type<int>::get_or(0, std::declval<int &>())), int &>,
+                "Arguments are forwarded without copies");
+  static_assert(std::is_same_v<decltype(var_pack::forward_type<int>::get_or(0, std::declval<TestPolicy &>())), int> &&
+                    std::is_same_v<decltype(var_pack::forward_type<TestBatch>::get_or(TestBatch{1})), TestBatch> &&
+                    std::is_same_v<decltype(var_pack::forward_type<int>::get_or(std::declval<const int &>())), int>,
+                "Default value is returned by value");
+  static_assert([]() {
+    auto &&batch = var_pack::forward_type<TestBatch>::get_or(TestBatch{8});
+    return 8 == batch.size;
+  }(), "Default value outlives the call");
+  static_assert([]() {
+    TestBatch batch{64};
+    const TestService service(TestPolicy{"lifo", 0.5}, std::move(batch));
+    return (0 == batch.size) && (64 == service.batch.size) && ("lifo" == service.policy.name) && (TestTimeout{100} == service.timeout);
+  }(), "Options in any order with moves");
+  static_assert([]() {
+    const TestService service{};
+    return (16 == service.batch.size) && ("fifo" == service.policy.name);
+  }(), "Default options");
+};
+
+class TestBundle {
+  using Options = bundle<TestSpeed, TestPin, TestPull>;
+  static constexpr Options options{TestSpeed::High, TestPin{7}, TestPull::Down};
+
+  static_assert((3U == Options::SIZE) && Options::contains_v<TestPin> && !Options::contains_v<TestMode>, "Indexed arguments");
+  static_assert(std::is_same_v<decltype(bundle(TestPin{1}, TestMode::Input)), bundle<TestPin, TestMode>>, "Deduction of the argument types");
+  static_assert((TestPin{7} == options.get<TestPin>()) && (TestSpeed::High == options.get<TestSpeed>()) &&
+                    (TestPull::Down == options.get_or<TestPull>(TestPull::None)) && (TestMode::Output == options.get_or<TestMode>(TestMode::Output)),
+                "Field access");
+  static_assert([]() {
+    bundle<TestPin, TestBatch> mixed(TestPin{1}, TestBatch{32});
+    mixed.get<TestPin>() = TestPin{2};
+    return (TestPin{2} == mixed.get<TestPin>()) && (32 == mixed.get<TestBatch>().size);
+  }(), "Mutable and move-only arguments");
+  static_assert([]() {
+    Options copy(options);
+    Options source(TestSpeed::Low, TestPin{3}, TestPull::Up);
+    const Options &constant = source;
+    Options other(constant);
+    return (TestPin{7} == copy.get<TestPin>()) && (TestPin{3} == other.get<TestPin>()) && (TestSpeed::Low == other.get<TestSpeed>());
+  }(), "Copy construction from mutable and constant bundles");
+  static_assert(std::is_copy_constructible_v<Options> && !std::is_constructible_v<Options, TestSpeed, TestPin>,
+                "Constructor takes one value per argument");
+};
+
+// Port with the list of pins and options given as one pack
+template <const TestPort port, const auto... params> class TestGpioPort {
+  static_assert(var_pack::is_type_val_list<TestPin, TestSpeed, TestPull>::contains_v(params...), "Wrong parameters");
+  static_assert((var_pack::count_v<TestSpeed, decltype(params)...> <= 1U) && (var_pack::count_v<TestPull, decltype(params)...> <= 1U),
+                "Options should be unique");
+
+public:
+  static constexpr auto PINS = var_pack::get_all<TestPin>(params...);
+  static constexpr auto SPEED = var_pack::type<TestSpeed>::get(params...);
+  static constexpr unsigned MASK = var_pack::fold_of<TestPin>(
+      0U, [](const unsigned mask, const TestPin pin) { return mask | (1U << static_cast<unsigned>(pin)); }, params...);
+};
+
+class TestGetAll {
+  using Port = TestGpioPort<TestPort::PA, TestPin{0}, TestPin{3}, TestSpeed::High, TestPin{5}, TestPin{6}, TestPull::Up, TestPin{7},
+                            TestPin{8}, TestPin{12}, TestPin{15}>;
+
+  static_assert((8U == Port::PINS.size()) && (TestPin{0} == Port::PINS[0]) && (TestPin{5} == Port::PINS[2]) && (TestPin{15} == Port::PINS[7]),
+                "All values of the type in the order");
+  static_assert((TestSpeed::High == Port::SPEED) && (0x91E9U == Port::MASK), "Options and batch operation");
+  static_assert((0U == var_pack::get_all<TestPin>(TestSpeed::Low).size()) && (0U == var_pack::count_v<TestPin>), "No values of the type");
+  static_assert([]() {
+    unsigned sum = 0;
+    var_pack::for_each_of<int>([&sum](const int value) { sum += static_cast<unsigned>(value); }, 1, 'c', 2, 3U, 4);
+    return 7U == sum;
+  }(), "Every value of the type");
+};
+
+class TestTypeSet {
+  using Options = var_pack::type_set<TestSpeed, TestPull, TestMode, TestType4, TestType5>;
+
+  static_assert(Options::contains_v<TestPull, TestType5> && Options::contains_v<> && !Options::contains_v<TestPull, TestPin>, "Membership");
+  static_assert(std::is_same_v<var_pack::is_type_list<TestSpeed, TestPull>::set, var_pack::is_type_val_list<TestSpeed, TestPull>::set>,
+                "One set is shared by type and value lists");
+  static_assert(var_pack::is_type_list<TestSpeed, TestPull, TestMode, TestType4, TestType5>::contains_v<TestMode, TestSpeed> &&
+                    var_pack::is_type_val_list<TestSpeed, TestPull, TestMode, TestType4, TestType5>::contains_v(TestType4::TestValue1, TestMode::Input) &&
+                    !var_pack::is_type_val_list<TestSpeed, TestPull>::contains_v(TestSpeed::Low, 1),
+                "Queries over the set");
+  static_assert(var_pack::is_type_list<int, long, int>::contains_v<long> && var_pack::is_type_list<int, long, int>::contains_v<int, long> &&
+                    !var_pack::is_type_list<int, long, int>::contains_v<char> && var_pack::is_type_val_list<int, long, int>::contains_v(1L) &&
+                    var_pack::type_set<TestPull, TestPull>::contains_v<TestPull>,
+                "Lists with repeated types");
+};
+
+using TestGpioWord = config_word<std::uint32_t, config_slot<TestPort, 4U>, config_slot<TestPin, 5U>, config_slot<TestMode, 2U>,
+                                 config_slot<TestSpeed, 2U>, config_slot<TestPull, 2U>>;
+
+// Configuration class with one template parameter instead of the value pack
+template <const std::uint32_t config> class TestCompactGpio {
+public:
+  static constexpr TestPort PORT = TestGpioWord::get<TestPort>(config);
+  static constexpr TestPin PIN = TestGpioWord::get<TestPin>(config);
+  static constexpr TestSpeed SPEED = TestGpioWord::get<TestSpeed>(config);
+  static constexpr TestPull PULL = TestGpioWord::get<TestPull>(config);
+};
+
+// Values are packed at compile time: a rejected value is not a constant expression (substitution failure)
+template <typename ConfigWord, const auto value, typename = void> struct can_pack : std::false_type {};
+template <typename ConfigWord, const auto value>
+struct can_pack<ConfigWord, value, std::void_t<std::integral_constant<typename ConfigWord::word_type, ConfigWord::pack(value)>>> : std::true_type {};
+
+using TestByteWord = config_word<std::uint8_t, config_slot<unsigned, 4U>, config_slot<int, 3U>>;
+using TestFullByteWord = config_word<std::uint8_t, config_slot<unsigned long long, 8U>>;
+
+class TestConfigWord {
+  using Led = TestCompactGpio<TestGpioWord::pack(TestPin{13}, TestPort::PB, TestSpeed::High, TestMode::Output)>;
+
+  static_assert((0U == TestGpioWord::OFFSET<TestPort>) && (9U == TestGpioWord::OFFSET<TestMode>) && (13U == TestGpioWord::OFFSET<TestPull>) &&
+                    (5U == TestGpioWord::WIDTH<TestPin>) && (0x1FU == TestGpioWord::MASK<TestPin>),
+                "Slots layout");
+  static_assert((1U | (13U << 4U) | (1U << 9U) | (3U << 11U)) == TestGpioWord::pack(TestPort::PB, TestPin{13}, TestMode::Output, TestSpeed::High),
+                "Packed word");
+  static_assert((TestPort::PB == Led::PORT) && (TestPin{13} == Led::PIN) && (TestSpeed::High == Led::SPEED) && (TestPull::None == Led::PULL),
+                "Values from the word, missed value is default");
+  static_assert(std::is_same_v<Led, TestCompactGpio<TestGpioWord::pack(TestPort::PB, TestMode::Output, TestSpeed::High, TestPin{13})>>,
+                "Same configuration in any order is the same instantiation");
+  static_assert(can_pack<TestByteWord, 0xFU>::value && !can_pack<TestByteWord, 0x10U>::value && !can_pack<TestByteWord, 0x100U>::value &&
+                    can_pack<TestFullByteWord, 0xFFULL>::value && !can_pack<TestFullByteWord, 0x100ULL>::value &&
+                    !can_pack<TestFullByteWord, 0x1000000FFULL>::value,
+                "Value wider than the slot or the word");
+  static_assert(can_pack<TestByteWord, 7>::value && !can_pack<TestByteWord, -1>::value && !can_pack<TestByteWord, 8>::value, "Negative value");
+};
+
+// Generated configuration: the marker is emitted by the generator after the full validation by the rules of the schema
+using TestRules = const_t<2U>;
+using TestStaleRules = const_t<1U>;
+struct TestBoardVerified : var_pack::verified<TestRules, TestPort::PB, TestPin{13}, TestSpeed::High, TestPull::Up>,
+                           var_pack::verified<TestRules, TestPort::PA>,
+                           var_pack::verified<TestStaleRules, TestPort::PB, TestPin{12}> {};
+
+template <typename Marker, const auto... params> class TestCheckedGpio {
+public:
+  static constexpr bool VALID = var_pack::validate<Marker, TestRules, params...>([](const auto... args) {
+    return var_pack::is_types_val_unique_v(args...) && var_pack::is_type_val_list<TestPort, TestPin, TestSpeed, TestPull>::contains_v(args...);
+  });
+};
+
+class TestVerified {
+  static_assert(var_pack::is_verified_v<TestBoardVerified, TestRules, TestPort::PB, TestPin{13}, TestSpeed::High, TestPull::Up> &&
+                    var_pack::is_verified_v<TestBoardVerified, TestRules, TestPort::PA> &&
+                    !var_pack::is_verified_v<TestBoardVerified, TestRules, TestPort::PB> &&
+                    !var_pack::is_verified_v<TestBoardVerified, TestRules, TestPort::PB, TestPin{12}, TestSpeed::High, TestPull::Up> &&
+                    !var_pack::is_verified_v<TestBoardVerified, TestRules, TestPin{13}, TestPort::PB, TestSpeed::High, TestPull::Up> &&
+                    !var_pack::is_verified_v<TestType1, TestRules, TestPort::PA> && !var_pack::is_verified_v<int, TestRules, TestPort::PA>,
+                "Marker matches only the same pack");
+  static_assert(var_pack::validate<TestBoardVerified, TestRules, TestPort::PB, TestPin{13}, TestSpeed::High, TestPull::Up>([](auto...) { return false; }),
+                "Verified pack skips the validation");
+  static_assert(TestCheckedGpio<TestBoardVerified, TestPort::PB, TestPin{12}, TestSpeed::High>::VALID &&
+                    !TestCheckedGpio<TestBoardVerified, TestPort::PB, TestPin{13}, TestPin{12}>::VALID &&
+                    !TestCheckedGpio<TestType1, TestPort::PB, TestMode::Input>::VALID,
+                "Stale configuration or missed marker falls back to the full validation");
+  static_assert(var_pack::is_stale_v<TestBoardVerified, TestRules, TestPort::PB, TestPin{12}> &&
+                    !var_pack::is_verified_v<TestBoardVerified, TestRules, TestPort::PB, TestPin{12}> &&
+                    var_pack::is_verified_v<TestBoardVerified, TestStaleRules, TestPort::PB, TestPin{12}> &&
+                    !var_pack::is_stale_v<TestBoardVerified, TestRules, TestPort::PA> &&
+                    !var_pack::is_stale_v<TestBoardVerified, TestRules, TestPort::PB, TestPin{12}, TestSpeed::High>,
+                "Marker of the stale schema is rejected by validate");
+};
+
+using TestGather = bit_gather<std::uint32_t, bit_range<const_t<16>, const_t<4>>, bit_range<const_t<0>, const_t<2>>, bit_range<const_t<28>, const_t<4>>,
+                              bit_range<const_t<4>, const_t<3>>, bit_range<const_t<7>, const_t<2>>>;
+
+class TestBitGather {
+  using Bytes = bit_gather<std::uint64_t, bit_range<const_t<56>, const_t<8>>, bit_range<const_t<0>, const_t<8>>>;
+  using Adjacent = bit_gather<std::uint8_t, bit_range<const_t<5>, const_t<3>>, bit_range<const_t<2>, const_t<3>>>;
+  using Whole = bit_gather<std::uint64_t, bit_range<const_t<0>, const_t<64>>>;
+
+  static_assert((5U == TestGather::SIZE) && (0xF00F01F3U == TestGather::MASK) && (15U == TestGather::WIDTH) && (4U == TestGather::RUNS),
+                "Combined mask, adjacent fields are one run");
+  static_assert((7U == TestGather::POSITION<0>) && (0U == TestGather::POSITION<1>) && (11U == TestGather::POSITION<2>) &&
+                    (2U == TestGather::POSITION<3>) && (5U == TestGather::POSITION<4>),
+                "Positions in the compact value");
+  static_assert(0x4E3BU == TestGather::extract_scalar(0x9A5C36E7U), "Gather");
+  static_assert((0xCU == TestGather::get<0>(0x4E3BU)) && (0x3U == TestGather::get<1>(0x4E3BU)) && (0x9U == TestGather::get<2>(0x4E3BU)) &&
+                    (0x6U == TestGather::get<3>(0x4E3BU)) && (0x1U == TestGather::get<4>(0x4E3BU)),
+                "Fields from the compact value");
+  static_assert((0xB234576AU == TestGather::insert_scalar(0x12345678U, 0x5A5AU)) &&
+                    ((0x9A5C36E7U & TestGather::MASK) == TestGather::insert_scalar(0U, TestGather::extract_scalar(0x9A5C36E7U))),
+                "Scatter");
+  static_assert((0xABCDU == Bytes::extract_scalar(0xAB000000000000CDULL)) && (0xEF123456789ABC01ULL == Bytes::insert_scalar(0x12123456789ABC34ULL, 0xEF01U)),
+                "64-bit word");
+  static_assert((1U == Adjacent::RUNS) && (0xFCU == Adjacent::MASK) && (0x2DU == Adjacent::extract_scalar(0xB4U)) && (3U == Adjacent::POSITION<0>),
+                "8-bit word");
+  static_assert((1U == Whole::RUNS) && (~0ULL == Whole::MASK) && (0x0123456789ABCDEFULL == Whole::extract_scalar(0x0123456789ABCDEFULL)), "Whole word");
+  static_assert((0U == bit_gather<std::uint32_t>::SIZE) && (0U == bit_gather<std::uint32_t>::MASK) && (0U == bit_gather<std::uint32_t>::RUNS) &&
+                    (0U == bit_gather<std::uint32_t>::extract_scalar(0x9A5C36E7U)) &&
+                    (0x9A5C36E7U == bit_gather<std::uint32_t>::insert_scalar(0x9A5C36E7U, 0xFFFFU)),
+                "No fields");
+};
+
+#ifdef ISO_META_TYPE_HOST
+// Runtime checks of the code that can't run in constant expressions (intrinsics, threads, memory-mapped access), host builds only:
+// the test executable (tests/host_tests.cpp) calls unit_tests::run_host_tests(), false means a failed check
+template <typename Shuffle, typename Element, std::size_t... I> inline bool shuffle_apply_check(std::index_sequence<I...>) {
+  const Element in[] = {static_cast<Element>(I * 3U + 1U)...};
+  Element out[sizeof...(I)] = {};
+  Element expected[sizeof...(I)] = {};
+  Shuffle::apply(in, out);
+  Shuffle::apply_scalar(in, expected);
+  return ((out[I] == expected[I]) && ...);
+}
+
+// Every instruction path of 'shuffle' against the scalar reference (paths not enabled for the target fall back to the scalar one)
+inline bool host_test_shuffle() {
+  return shuffle_apply_check<shuffle<std::uint8_t, 0, 1, 2, 3>, std::uint8_t>(std::make_index_sequence<4>{}) &&
+         shuffle_apply_check<shuffle<std::uint32_t, 3U, 2U, 1U, 0U>, std::uint32_t>(std::make_index_sequence<4>{}) &&
+         shuffle_apply_check<shuffle<std::uint8_t, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11>, std::uint8_t>(std::make_index_sequence<16>{}) &&
+         shuffle_apply_check<ByteSwap32, std::uint8_t>(std::make_index_sequence<16>{}) &&
+         shuffle_apply_check<shuffle<std::uint32_t, 7, 0, 6, 1, 5, 2, 4, 3>, std::uint32_t>(std::make_index_sequence<8>{}) &&
+         shuffle_apply_check<shuffle<std::uint16_t, 2, 2, 0>, std::uint16_t>(std::make_index_sequence<3>{});
+}
+
+// Both instruction paths of 'bit_gather' against the shift and mask reference over pseudo-random words
+template <typename Gather> inline bool bit_gather_check() {
+  using Word = typename Gather::word_type;
+  std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+  bool passed = (Gather::extract(Word{0}) == Gather::extract_scalar(Word{0})) &&
+                (Gather::insert(Word{0}, static_cast<Word>(~Word{0})) == Gather::insert_scalar(Word{0}, static_cast<Word>(~Word{0})));
+  for (std::size_t i = 0; i < 256U; i++) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const Word word = static_cast<Word>(state >> 7U);
+    const Word compact = static_cast<Word>(state >> 29U);
+    passed = passed && (Gather::extract(word) == Gather::extract_scalar(word)) && (Gather::insert(word, compact) == Gather::insert_scalar(word, compact));
+  }
+  return passed;
+}
+
+// Sparse masks (several runs) use pext/pdep when BMI2 is enabled, empty and one-run (also full) masks are always the shift and the mask
+inline bool host_test_bit_gather() {
+  using Empty = bit_gather<std::uint32_t>;
+  using Full32 = bit_gather<std::uint32_t, bit_range<const_t<0>, const_t<32>>>;
+  using Full64 = bit_gather<std::uint64_t, bit_range<const_t<0>, const_t<64>>>;
+  using Bytes = bit_gather<std::uint64_t, bit_range<const_t<56>, const_t<8>>, bit_range<const_t<0>, const_t<8>>>;
+  using Sparse64 = bit_gather<std::uint64_t, bit_range<const_t<1>, const_t<1>>, bit_range<const_t<3>, const_t<1>>, bit_range<const_t<10>, const_t<2>>,
+                              bit_range<const_t<40>, const_t<5>>, bit_range<const_t<63>, const_t<1>>>;
+  using Sparse16 = bit_gather<std::uint16_t, bit_range<const_t<15>, const_t<1>>, bit_range<const_t<0>, const_t<3>>, bit_range<const_t<7>, const_t<2>>>;
+  using Sparse8 = bit_gather<std::uint8_t, bit_range<const_t<0>, const_t<1>>, bit_range<const_t<7>, const_t<1>>>;
+  return bit_gather_check<Empty>() && bit_gather_check<Full32>() && bit_gather_check<Full64>() && bit_gather_check<TestGather>() &&
+         bit_gather_check<Bytes>() && bit_gather_check<Sparse64>() && bit_gather_check<Sparse16>() && bit_gather_check<Sparse8>();
+}
+
+// Division by zero saturates in runtime (and does not compile in constant evaluation)
+inline bool host_test_fixed_point() {
+  volatile std::int16_t zero = 0;
+  return (Q8_8::from_raw(0x7FFF) == Q8_8(const_v<3>) / Q8_8::from_raw(zero)) && (Q8_8::from_raw(-0x8000) == Q8_8(const_v<-3>) / Q8_8::from_raw(zero));
+}
+
+// Every task of Pipeline ran exactly once and started after all its dependencies had finished
+inline bool pipeline_traced() {
+  bool passed = true;
+  for (std::size_t task = 0; task < Pipeline::SIZE; task++) {
+    passed = passed && (1U == task_runs[task]);
+    for (std::size_t edge = Pipeline::resolved.first[task]; edge < Pipeline::resolved.first[task + 1U]; edge++) {
+      passed = passed && (task_started[Pipeline::resolved.successors[edge]] > task_finished[task]);
+    }
+  }
+  return passed;
+}
+
+inline void pipeline_trace_reset() {
+  task_clock = 0;
+  for (std::size_t task = 0; task < Pipeline::SIZE; task++) {
+    task_runs[task] = task_started[task] = task_finished[task] = 0;
+  }
+}
+
+// Graph runs sequentially and on the pool with several workers (repeatedly, the pool is reused between the runs)
+inline bool host_test_task_graph() {
+  pipeline_trace_reset();
+  Pipeline::run();
+  bool passed = pipeline_traced();
+  for (const std::size_t workers : {1U, 2U, 4U}) {
+    work_stealing_pool pool(workers);
+    for (std::size_t round = 0; round < 100U; round++) {
+      pipeline_trace_reset();
+      Pipeline::run(pool);
+      passed = passed && pipeline_traced();
+    }
+  }
+  return passed;
+}
+
+// Reading past the last element gives zero in runtime (and does not compile in constant evaluation)
+inline bool host_test_compressed() {
+  using Curve = compressed<calibration_curve, 16U>;
+  volatile std::size_t index = Curve::SIZE;
+  Curve::reader stream(Curve::SIZE - 1U);
+  Curve::reader past(Curve::SIZE + 5U);
+  return (9 == stream.next()) && (0 == stream.next()) && stream.empty() && (0 == Curve::at(index)) && (0 == Curve::at(index + 1U)) &&
+         past.empty() && (Curve::SIZE == past.index()) && (0 == past.next()) && (Curve::SIZE == past.index());
+}
+
+// Graph with a failing task: the exception is rethrown by 'run', successors of the failed task are skipped
+inline std::atomic<std::size_t> failing_runs[3];
+struct Fail {
+  static void run() {
+    failing_runs[0]++;
+    throw 42;
+  }
+};
+struct AfterFail {
+  using dependencies = type_list<Fail>;
+  static void run() { failing_runs[1]++; }
+};
+struct Independent {
+  static void run() { failing_runs[2]++; }
+};
+using FailingGraph = task_graph<AfterFail, Independent, Fail>;
+
+inline bool host_test_task_graph_exception() {
+  bool passed = true;
+  work_stealing_pool pool(4U);
+  for (std::size_t round = 0; round < 100U; round++) {
+    failing_runs[0] = failing_runs[1] = failing_runs[2] = 0;
+    bool thrown = false;
+    try {
+      FailingGraph::run(pool);
+    } catch (const int error) {
+      thrown = (42 == error);
+    }
+    passed = passed && thrown && (1U == failing_runs[0]) && (0U == failing_runs[1]) && (failing_runs[2] <= 1U);
+  }
+  // The pool is used again after the failure
+  pipeline_trace_reset();
+  Pipeline::run(pool);
+  return passed && pipeline_traced();
+}
+
+// Services are wired to each other, constructed in the dependency order and destroyed in the reverse one
+inline bool host_test_service_container() {
+  service_destroyed_count = 0;
+  Services::construct();
+  const bool wired = (&Services::get<Service>().transport == &Services::get<Transport>()) &&
+                     (&Services::get<Transport>().config == &Services::get<Config>()) && (1U == Services::get<Service>().counter);
+  Services::destroy();
+  return wired && (3U == service_destroyed_count) && (3U == service_destroyed[0]) && (2U == service_destroyed[1]) && (1U == service_destroyed[2]);
+}
+
+// Registers are written through the handle to the substituted array
+inline bool host_test_peripheral() {
+  test_peripheral_memory.control = 0;
+  test_peripheral_memory.status = 0;
+  test_peripheral_memory.data = 0;
+  TestPeripheral uart;
+  uart->control = 0x1U;
+  (*uart).data = 0x55U;
+  return (0x1U == test_peripheral_memory.control) && (0U == test_peripheral_memory.status) && (0x55U == test_peripheral_memory.data) &&
+         (0x55U == TestPeripheral::registers()->data);
+}
+
+inline bool run_host_tests() {
+  return host_test_shuffle() && host_test_fixed_point() && host_test_task_graph() && host_test_task_graph_exception() &&
+         host_test_service_container() && host_test_peripheral() && host_test_compressed() && host_test_bit_gather();
+}
+#endif
 }; // namespace unit_tests
 #endif
 
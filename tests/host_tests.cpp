@@ -0,0 +1,10 @@
+// Test executable of the host builds: compile-time tests run during the compilation of the header, runtime ones are called here
+#include "meta_types.hpp"
+
+#include <cstdio>
+
+int main() {
+  const bool passed = iso::meta_type::unit_tests::run_host_tests();
+  std::puts(passed ? "meta_types host tests passed" : "meta_types host tests failed");
+  return passed ? 0 : 1;
+}